@@ -0,0 +1,85 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Формат архива ресурсов (little-endian):
+//   PackHeader
+//   данные файлов, каждый выровнен на PACK_ALIGNMENT
+//   индекс: entryCount записей PackIndexEntry, за каждой - имя длиной nameLength
+// Имена - пути, по которым игра обращается к ресурсам ("assets/sounds/flip.wav").
+// Архив собирает утилита tools/pack_assets.
+struct PackHeader {
+    char magic[8];            // "MGPACK1\0"
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint64_t indexOffset;
+    std::uint64_t indexSize;
+};
+
+struct PackIndexEntry {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint64_t hash;       // FNV-1a содержимого - ключ версии для кэшей
+    std::uint32_t nameLength;
+};
+
+const char PACK_MAGIC[8] = {'M', 'G', 'P', 'A', 'C', 'K', '1', '\0'};
+const std::uint32_t PACK_VERSION = 1;
+const std::uint64_t PACK_ALIGNMENT = 16;
+
+// Архив ресурсов, отображенный в память один раз при старте.
+// Загрузчики получают указатель прямо на отображенные байты и передают
+// его в loadFromMemory/openFromMemory без копирования и открытия файлов.
+// Если архива нет, find() ничего не находит и все читается с диска как раньше.
+// Путь задает MEMORY_GAME_ASSET_PACK (по умолчанию assets.pack).
+class AssetPack {
+public:
+    struct Entry {
+        const void* data;
+        std::size_t size;
+        std::uint64_t hash;
+    };
+    
+    static AssetPack& getInstance();
+    
+    bool isOpen() const { return mapping != nullptr; }
+    const std::string& getPath() const { return path; }
+    
+    // nullptr, если ресурса нет в архиве или его заменил файл на диске.
+    // Безопасен для вызова из потоков предзагрузки
+    const Entry* find(const std::string& name) const;
+    
+    // Файл name на диске новее копии в архиве: дальше он читается с диска.
+    // enabled=false возвращает копию из архива (файл на диске удален)
+    void setOverridden(const std::string& name, bool enabled);
+    
+    // Файлы, лежащие прямо в папке directory (без вложенных), в порядке имен
+    std::vector<std::string> list(const std::string& directory) const;
+    
+private:
+    AssetPack();
+    ~AssetPack();
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+    
+    bool open(const std::string& packPath);
+    void close();
+    
+    std::string path;
+    void* mapping;
+    std::size_t mappingSize;
+    std::unordered_map<std::string, Entry> entries;
+    std::vector<std::string> sortedNames;
+    
+    mutable std::shared_mutex overrideMutex;
+    std::unordered_set<std::string> overridden;
+};
+
+#endif
@@ -7,7 +7,7 @@
 
 class ContactForm {
 private:
-    sf::Font font;
+    const sf::Font* font;  // Общий шрифт, форма им не владеет
     
     sf::Text titleText;
     sf::Text nameLabel;
@@ -36,7 +36,7 @@ private:
 public:
     ContactForm();
     
-    bool loadFont(const std::string& fontPath);
+    void setFont(const sf::Font& sharedFont);
     void setup(float windowWidth, float windowHeight);
     void handleEvent(const sf::Event& event, const sf::Vector2f& mousePos);
     void update(const sf::Vector2f& mousePos);
@@ -5,17 +5,7 @@
 #include <vector>
 #include <memory>
 #include <libpq-fe.h>
-
-struct GameRecord {
-    int id;
-    std::string playerName;
-    int score;
-    int moves;
-    int pairs;
-    double time;
-    std::string date;
-    std::string difficulty;
-};
+#include "GameRecord.h"
 
 class Database {
 private:
@@ -38,6 +28,7 @@ public:
     bool initialize();
     bool saveGame(const GameRecord& record);
     std::vector<GameRecord> getTopScores(int limit = 10);
+    bool fetchTopScores(int limit, std::vector<GameRecord>& records);
     std::vector<GameRecord> getPlayerHistory(const std::string& playerName, int limit = 10);
     
     bool createUser(const std::string& username, const std::string& password, 
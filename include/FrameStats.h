@@ -0,0 +1,43 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <string>
+
+// Статистика равномерности кадров игрового цикла.
+// Копит длительности кадров за окно reportInterval и формирует отчет.
+class FrameStats {
+private:
+    float reportInterval;
+    float targetFrameTime;
+    
+    float windowTime;
+    int frameCount;
+    int simulationSteps;
+    int droppedSteps;
+    int hitchCount;
+    float minFrameTime;
+    float maxFrameTime;
+    double sumFrameTime;
+    double sumSquaredFrameTime;
+    
+public:
+    FrameStats(float reportInterval = 5.0f);
+    
+    void setTargetFrameTime(float seconds) { targetFrameTime = seconds; }
+    float getTargetFrameTime() const { return targetFrameTime; }
+    
+    // frameSeconds - реальная длительность кадра,
+    // steps - сколько шагов симуляции выполнено за кадр,
+    // dropped - сколько шагов отброшено из-за ограничения накопителя
+    void addFrame(float frameSeconds, int steps = 1, int dropped = 0);
+    
+    bool isReportReady() const { return windowTime >= reportInterval && frameCount > 0; }
+    std::string buildReport() const;
+    void reset();
+    
+    float getAverageFrameTime() const;
+    float getJitter() const;
+    int getHitchCount() const { return hitchCount; }
+};
+
+#endif
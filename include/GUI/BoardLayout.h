@@ -0,0 +1,50 @@
+#ifndef BOARDLAYOUT_H
+#define BOARDLAYOUT_H
+
+#include <SFML/Graphics.hpp>
+
+// Геометрия игрового поля: сетка карт одинакового размера.
+// Позволяет по точке сразу получить индекс карты и по видимой
+// области - диапазон строк и столбцов без перебора всех карт.
+class BoardLayout {
+public:
+    // Полуоткрытый диапазон ячеек [firstRow, endRow) x [firstCol, endCol)
+    struct Range {
+        int firstRow, endRow;
+        int firstCol, endCol;
+        
+        bool isEmpty() const { return firstRow >= endRow || firstCol >= endCol; }
+        int getCount() const { return isEmpty() ? 0 : (endRow - firstRow) * (endCol - firstCol); }
+        bool operator==(const Range& other) const {
+            return firstRow == other.firstRow && endRow == other.endRow &&
+                   firstCol == other.firstCol && endCol == other.endCol;
+        }
+        bool operator!=(const Range& other) const { return !(*this == other); }
+    };
+    
+    BoardLayout();
+    
+    void configure(int rows, int cols, float cardSize, float spacing, const sf::Vector2f& origin);
+    
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    float getCardSize() const { return cardSize; }
+    sf::FloatRect getBounds() const;
+    
+    sf::Vector2f getCardPosition(int index) const;
+    
+    // Индекс карты под точкой или -1 (промежутки между картами тоже -1)
+    int cardAt(const sf::Vector2f& point) const;
+    
+    // Ячейки, пересекающие прямоугольник (обычно - видимую часть вида)
+    Range getRange(const sf::FloatRect& area) const;
+    
+private:
+    int rows;
+    int cols;
+    float cardSize;
+    float spacing;
+    sf::Vector2f origin;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef BOARDRENDERER_H
+#define BOARDRENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "GUI/CardSprite.h"
+#include "GUI/BoardLayout.h"
+
+// Пакетная отрисовка игрового поля.
+// Рамки и фон видимых карт лежат в одном массиве вершин, картинки - во втором
+// (с текстурой общего атласа), так что поле рисуется за два вызова draw
+// независимо от размера. Карты вне видимой области в массивы не попадают.
+// Вершины карты пересчитываются только когда у нее изменилась версия
+// (состояние, позиция, размер, картинка, анимация).
+class BoardRenderer {
+private:
+    static const size_t SHAPE_VERTICES = 12;  // Рамка + фон, по два треугольника
+    static const size_t IMAGE_VERTICES = 6;   // Картинка, два треугольника
+    
+    sf::VertexArray shapeVertices;
+    sf::VertexArray imageVertices;
+    std::vector<int> slotCards;              // Индекс карты для каждого слота вершин
+    std::vector<unsigned int> slotVersions;
+    BoardLayout::Range visibleRange;
+    std::vector<const CardSprite*> textCards;  // Карты без картинки рисуются текстом
+    bool valid;
+    
+    void writeCard(size_t slot, const CardSprite& card);
+    static void writeQuad(sf::Vertex* quad, const sf::FloatRect& rect, const sf::Color& color);
+    
+public:
+    BoardRenderer();
+    
+    // Следующий кадр пересоберет все вершины (например, после создания новых карт)
+    void invalidate() { valid = false; }
+    
+    // Пересобирает слоты при смене видимого диапазона, иначе досчитывает изменившиеся карты
+    void update(const std::vector<std::unique_ptr<CardSprite>>& cards,
+                const BoardLayout& layout, const BoardLayout::Range& range);
+    
+    size_t getVisibleCount() const { return slotCards.size(); }
+    
+    void render(sf::RenderTarget& target) const;
+};
+
+#endif
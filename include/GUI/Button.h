@@ -9,6 +9,7 @@ class Button {
 private:
     sf::RectangleShape shape;
     sf::Text text;
+    sf::Text shadow;  // Готовая тень подписи, обновляется вместе с текстом
     const sf::Font* fontPtr;
     
     sf::Color idleColor;
@@ -17,16 +18,30 @@ private:
     
     std::function<void()> onClick;
     
+    bool hovered;
+    bool pressed;          // Зажата левой кнопкой - до отпускания держит activeColor
+    unsigned int version;  // Меняется при смене текста, позиции, цветов или шрифта
+    
+    void layoutText();
+    // Цвета фигуры по текущему состоянию: нажата, под курсором или обычная
+    void applyStateColors();
+    static unsigned int nextVersion();
+    
 public:
-    Button() : fontPtr(nullptr) {}
+    Button() : fontPtr(nullptr), hovered(false), pressed(false), version(0) {}
     
     Button(float x, float y, float width, float height, 
            const std::string& textStr, 
            const sf::Font& font,
            std::function<void()> onClickFunc);
     
-    void update(const sf::Vector2f& mousePos);
-    void render(sf::RenderWindow& window);
+    // Обновляет наведение; возвращает true, если оно изменилось
+    bool update(const sf::Vector2f& mousePos);
+    void render(sf::RenderTarget& target) const;
+    // Рисует кнопку в обычном виде, независимо от наведения (для кэшируемых слоев)
+    void renderIdle(sf::RenderTarget& target) const;
+    // Рисует только подпись с тенью
+    void renderText(sf::RenderTarget& target) const;
     void handleEvent(const sf::Event& event, const sf::Vector2f& mousePos);
     
     void setPosition(float x, float y);
@@ -35,6 +50,11 @@ public:
     void setText(const std::string& textStr);
     void setFont(const sf::Font& font);
     bool hasValidFont() const { return fontPtr != nullptr; }
+    bool isHovered() const { return hovered; }
+    const sf::RectangleShape& getShape() const { return shape; }
+    const sf::Text& getText() const { return text; }
+    const sf::Font* getFont() const { return fontPtr; }
+    unsigned int getVersion() const { return version; }
 };
 
 #endif
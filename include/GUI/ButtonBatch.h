@@ -0,0 +1,43 @@
+#ifndef BUTTONBATCH_H
+#define BUTTONBATCH_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "GUI/Button.h"
+
+// Пакетная отрисовка кнопок экрана.
+// Рамки и фоны всех кнопок лежат в одном массиве вершин, подписи вместе
+// с тенями - во втором (с текстурой глифов шрифта), так что набор кнопок
+// рисуется за два вызова draw. Вершины пересобираются только когда у
+// какой-нибудь кнопки изменились текст, положение, цвета или наведение.
+class ButtonBatch {
+private:
+    static const size_t SHAPE_VERTICES = 30;  // Четыре полосы рамки + фон, по два треугольника
+    
+    sf::VertexArray shapeVertices;
+    sf::VertexArray glyphVertices;
+    const sf::Font* font;
+    unsigned int characterSize;
+    std::vector<const Button*> fallbackButtons;  // Кнопки с другим шрифтом или размером
+    
+    const Button* cachedData;
+    size_t cachedCount;
+    unsigned long long cachedKey;
+    bool valid;
+    
+    static unsigned long long computeKey(const std::vector<Button>& buttons);
+    void rebuild(const std::vector<Button>& buttons);
+    void writeShape(sf::Vertex* vertices, const sf::RectangleShape& shape) const;
+    void appendText(const sf::Text& text, const sf::Color& color, const sf::Vector2f& offset);
+    static void writeQuad(sf::Vertex* quad, const sf::FloatRect& rect, const sf::Color& color);
+
+public:
+    ButtonBatch();
+    
+    void invalidate() { valid = false; }
+    
+    // Рисует кнопки, при необходимости пересобрав вершины
+    void render(sf::RenderTarget& target, const std::vector<Button>& buttons);
+};
+
+#endif
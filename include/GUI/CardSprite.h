@@ -15,17 +15,28 @@ class CardSprite {
 private:
     sf::RectangleShape shape;
     sf::Text symbolText;
-    sf::Sprite imageSprite;
-    sf::Texture imageTexture;
+    sf::Text symbolShadow;
+    sf::RectangleShape symbolBackground;
+    sf::Sprite imageSprite;  // Ссылается на ячейку общего атласа TextureAtlas
     
     int id;
     std::string symbol;
     CardState state;
+    CardState previousState;  // Лицо, видимое в первой половине переворота
     bool isClickable;
     bool hasImage;
+    bool hasSymbolQuad;  // Картинка - растеризованный символ из SymbolAtlas
+    unsigned int version;  // Растет при любом изменении внешнего вида
+    
+    // Значения анимаций, выставляются из TweenSystem (1 - анимация завершена)
+    float flipProgress;
+    float pulseProgress;
+    float fadeProgress;
     
     void centerText();
     void centerImage();
+    bool loadSymbolQuad();
+    void applyAppearance();
     
 public:
     CardSprite(int id, const std::string& symbol, float x, float y, float size);
@@ -44,14 +55,28 @@ public:
     void markMatched();
     
     bool contains(const sf::Vector2f& point) const;
-    void update(float deltaTime);
+    
+    void setFlipProgress(float progress);
+    void setPulseProgress(float progress);
+    void setFadeProgress(float progress);
+    
+    // Состояние, которое сейчас видно на экране (во время переворота - старое до середины)
+    CardState getDisplayedState() const;
+    sf::Vector2f getAnimationScale() const;
+    sf::Uint8 getAnimationAlpha() const;
     void render(sf::RenderWindow& window);
     
+    // Рисует текстовый символ (для карт, чей символ не попал в атлас)
+    void renderSymbol(sf::RenderTarget& target) const;
+    
     int getId() const { return id; }
     std::string getSymbol() const { return symbol; }
     CardState getState() const { return state; }
     bool getIsClickable() const { return isClickable; }
     bool getHasImage() const { return hasImage; }
+    unsigned int getVersion() const { return version; }
+    const sf::RectangleShape& getShape() const { return shape; }
+    const sf::Sprite& getImageSprite() const { return imageSprite; }
 };
 
 #endif
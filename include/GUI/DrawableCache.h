@@ -0,0 +1,33 @@
+#ifndef DRAWABLECACHE_H
+#define DRAWABLECACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Набор заранее собранных элементов экрана.
+// Элементы создаются один раз при пересборке и рисуются в порядке
+// добавления, пока кэш не будет сброшен через invalidate().
+class DrawableCache {
+private:
+    std::vector<std::unique_ptr<sf::Drawable>> drawables;
+    bool valid;
+    
+public:
+    DrawableCache() : valid(false) {}
+    
+    bool isValid() const { return valid; }
+    void invalidate() { valid = false; }
+    
+    // Очищает содержимое и помечает кэш актуальным
+    void beginRebuild();
+    
+    sf::Text& addText(const std::string& str, const sf::Font& font, unsigned int size);
+    sf::RectangleShape& addRect(const sf::Vector2f& size);
+    
+    void render(sf::RenderTarget& target) const;
+    size_t getSize() const { return drawables.size(); }
+};
+
+#endif
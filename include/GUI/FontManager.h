@@ -0,0 +1,67 @@
+#ifndef FONTMANAGER_H
+#define FONTMANAGER_H
+
+#include <SFML/Graphics.hpp>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Общие шрифты процесса. Каждый шрифт ищется и загружается один раз
+// (из архива ресурсов раньше, чем с диска), виджеты держат ссылку на него.
+// Глифы SFML растеризует при первом выводе каждого размера, что дает рывок
+// на первом кадре нового экрана, поэтому используемые размеры прогреваются
+// заранее: нужные первому экрану - при старте, остальные - в простое.
+class FontManager {
+public:
+    static FontManager& getInstance();
+    
+    // Шрифт под именем name. Объект существует и до загрузки, поэтому
+    // ссылку можно взять заранее (например, в списке инициализации)
+    sf::Font& getFont(const std::string& name);
+    
+    // Загружает шрифт name из первого подходящего пути. Повторный вызов
+    // для уже загруженного шрифта файлы не трогает
+    bool load(const std::string& name, const std::vector<std::string>& paths);
+    bool isLoaded(const std::string& name) const;
+    const std::string& getPath(const std::string& name) const;
+    
+    // Растеризует латиницу и кириллицу сразу
+    void warmUp(const sf::Font& font, unsigned int characterSize, bool bold = false, float outline = 0.0f);
+    
+    // То же, но откладывает работу до warmUpPending
+    void queueWarmUp(const sf::Font& font, unsigned int characterSize, bool bold = false, float outline = 0.0f);
+    
+    // Растеризует отложенные глифы, пока не выйдет budget; true - очередь пуста
+    bool warmUpPending(sf::Time budget);
+    bool hasPendingWarmUp() const { return !pending.empty(); }
+    
+    // Освобождает шрифты - вызывается до закрытия окна
+    void clear();
+
+private:
+    FontManager() = default;
+    FontManager(const FontManager&) = delete;
+    FontManager& operator=(const FontManager&) = delete;
+    
+    struct Slot {
+        std::unique_ptr<sf::Font> font;
+        std::string path;  // Пустой, пока шрифт не загружен
+    };
+    
+    struct WarmUpJob {
+        const sf::Font* font;
+        unsigned int characterSize;
+        bool bold;
+        float outline;
+        size_t next;  // Индекс следующего символа в getWarmUpCharacters()
+    };
+    
+    static const std::vector<sf::Uint32>& getWarmUpCharacters();
+    
+    std::unordered_map<std::string, Slot> slots;
+    std::deque<WarmUpJob> pending;
+};
+
+#endif
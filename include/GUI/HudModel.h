@@ -0,0 +1,41 @@
+#ifndef HUDMODEL_H
+#define HUDMODEL_H
+
+#include <string>
+
+// Модель HUD игрового экрана.
+// Хранит последние показанные значения, чтобы тексты пересобирались
+// только при реальном изменении, а не каждый кадр.
+class HudModel {
+private:
+    int timerSeconds;
+    int moves;
+    int matchedPairs;
+    int totalPairs;
+    int score;
+    bool valid;
+    
+public:
+    HudModel();
+    
+    // Сбрасывает запомненные значения - следующее обновление перестроит все тексты
+    void invalidate() { valid = false; }
+    bool isValid() const { return valid; }
+    void markValid() { valid = true; }
+    
+    // Возвращают true, если значение изменилось (или модель сброшена)
+    bool setTimer(int seconds);
+    bool setProgress(int newMoves, int newMatchedPairs, int newTotalPairs);
+    bool setScore(int newScore);
+    
+    std::string formatTimer() const;
+    std::string formatScore() const;
+    
+    int getTimerSeconds() const { return timerSeconds; }
+    int getMoves() const { return moves; }
+    int getMatchedPairs() const { return matchedPairs; }
+    int getTotalPairs() const { return totalPairs; }
+    int getScore() const { return score; }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef IMAGEPREFETCHER_H
+#define IMAGEPREFETCHER_H
+
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "GUI/ThumbnailCache.h"
+
+// Пул потоков, заранее декодирующий картинки карт в sf::Image.
+// Работает только с памятью и диском - текстуры на GPU заливает главный поток,
+// забирая готовые изображения через take(). Каждый поток держит свою копию
+// ThumbnailCache, поэтому миниатюры читаются и пишутся без общей блокировки.
+class ImagePrefetcher {
+public:
+    ImagePrefetcher();
+    ~ImagePrefetcher();
+    
+    ImagePrefetcher(const ImagePrefetcher&) = delete;
+    ImagePrefetcher& operator=(const ImagePrefetcher&) = delete;
+    
+    // Настройки кэша миниатюр и размер, до которого уменьшаются картинки
+    void configure(const ThumbnailCache& cache, unsigned int maxSide);
+    
+    // Ставит пути в очередь вместо еще не начатых (выбор игрока сменился).
+    // Готовые картинки, которых нет в новом списке, выбрасываются
+    void request(const std::vector<std::string>& paths);
+    
+    // Забирает готовое изображение. Если оно декодируется прямо сейчас - ждет,
+    // если еще в очереди - снимает его оттуда и возвращает false
+    bool take(const std::string& path, sf::Image& image);
+    
+    // Выбрасывает результат для path (файл изменился); идущее декодирование дожидается
+    void forget(const std::string& path);
+    
+    // Останавливает потоки и выбрасывает результаты
+    void stop();
+
+private:
+    void startWorkers();
+    void workerLoop();
+    
+    ThumbnailCache cacheSettings;
+    unsigned int maxSide;
+    
+    mutable std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+    std::vector<std::thread> workers;
+    bool stopRequested;
+    
+    std::deque<std::string> queue;
+    std::unordered_set<std::string> queued;
+    std::unordered_set<std::string> inProgress;
+    std::unordered_set<std::string> requested;  // Пути последнего request
+    std::unordered_map<std::string, sf::Image> ready;
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef JPEGDECODER_H
+#define JPEGDECODER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+// Декодирование JPEG сразу в уменьшенном размере через libjpeg(-turbo).
+// Масштабированный IDCT (1/2, 1/4, 1/8) пропускает коэффициенты, ненужные
+// для мелкой картинки, поэтому большой снимок не разворачивается в память
+// целиком. Результат не меньше minSide по большей стороне - окончательное
+// уменьшение делает ThumbnailCache::downscale. Цвет libjpeg-turbo переводит
+// сразу в RGBA своими SIMD-ветками.
+// UNSUPPORTED (не JPEG, неподдерживаемый вариант или сборка без libjpeg,
+// MEMORY_GAME_HAVE_JPEG не задан) - вызывающий декодирует картинку через SFML.
+// CORRUPT - файл оборван или поврежден; SFML дорисовал бы его так же, только
+// в полном размере, поэтому такая картинка считается испорченной.
+class JpegDecoder {
+public:
+    enum class Result {
+        DECODED,
+        UNSUPPORTED,
+        CORRUPT
+    };
+    
+    static bool isJpeg(const void* data, std::size_t size);
+    static bool isJpegPath(const std::string& path);
+    
+    static Result decode(const void* data, std::size_t size, unsigned int minSide, sf::Image& image);
+    static Result decodeFile(const std::string& path, unsigned int minSide, sf::Image& image);
+};
+
+#endif
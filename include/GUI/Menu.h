@@ -5,10 +5,12 @@
 #include <vector>
 #include <functional>
 #include "GUI/Button.h"
+#include "GUI/ButtonBatch.h"
 
 class Menu {
 private:
     std::vector<Button> buttons;
+    ButtonBatch buttonBatch;
     sf::RectangleShape background;
     sf::Text title;
     bool isVisible;
@@ -0,0 +1,71 @@
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Частицы для обратной связи: вспышка при совпадении пары и салют на экране победы.
+// Данные лежат в параллельных массивах фиксированной емкости, поэтому циклы
+// обновления идут без ветвлений и векторизуются компилятором, а вся система
+// рисуется одним массивом вершин. Число частиц ограничено жестким бюджетом,
+// который дополнительно масштабируется уровнем качества по запасу времени кадра.
+class ParticleSystem {
+public:
+    explicit ParticleSystem(size_t capacity = 1024);
+    
+    // Разовый выброс count частиц из точки (при низком качестве - меньше)
+    void burst(const sf::Vector2f& center, const sf::Color& color, size_t count, float speed = 180.0f);
+    
+    // Непрерывный салют сверху области area в течение duration секунд
+    void startConfetti(const sf::FloatRect& area, float duration, float ratePerSecond = 300.0f);
+    void stopEmitting();
+    
+    void update(float deltaTime);
+    void render(sf::RenderTarget& target);
+    void clear();
+    
+    // Подстраивает качество по времени работы кадра: frameWorkSeconds - сколько
+    // кадр реально считался, targetFrameSeconds - сколько на него отведено
+    void adaptQuality(float frameWorkSeconds, float targetFrameSeconds);
+    void setQuality(float value);
+    float getQuality() const { return quality; }
+    
+    bool isActive() const { return count > 0 || confettiTimeLeft > 0.0f; }
+    size_t getActiveCount() const { return count; }
+    size_t getBudget() const;
+    
+private:
+    void spawn(float x, float y, float vx, float vy, float life, float size, float fall,
+               const sf::Color& color);
+    float random01();
+    void rebuildVertices();
+    
+    size_t capacity;
+    size_t count;
+    
+    // Структура массивов: каждая характеристика частицы в своем массиве
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;         // Оставшееся время жизни, с
+    std::vector<float> invMaxLife;   // 1 / начальное время жизни
+    std::vector<float> sizes;
+    std::vector<float> gravity;      // Искры почти невесомы, конфетти падает
+    std::vector<sf::Color> colors;
+    
+    sf::VertexArray vertices;
+    bool verticesDirty;
+    
+    float quality;           // 0.2..1, доля бюджета и плотность выбросов
+    float averageWork;       // Сглаженное время работы кадра
+    
+    sf::FloatRect confettiArea;
+    float confettiTimeLeft;
+    float confettiRate;
+    float confettiCarry;     // Дробная часть частиц, не выпущенных в прошлом кадре
+    
+    std::uint32_t rngState;
+};
+
+#endif
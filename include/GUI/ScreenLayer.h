@@ -0,0 +1,30 @@
+#ifndef SCREENLAYER_H
+#define SCREENLAYER_H
+
+#include <SFML/Graphics.hpp>
+
+// Слой статичного содержимого экрана, отрисованный в текстуру.
+// Собирается один раз и выводится одним спрайтом, пока не изменится
+// ключ содержимого или размер области вывода; живые элементы рисуются поверх.
+class ScreenLayer {
+private:
+    sf::RenderTexture texture;
+    sf::Sprite sprite;
+    bool valid;
+    unsigned long long contentKey;
+    
+public:
+    ScreenLayer();
+    
+    bool needsRebuild(unsigned long long key, const sf::Vector2u& size) const;
+    void invalidate() { valid = false; }
+    
+    // Начинает пересборку: возвращает очищенную цель с заданным видом
+    // или nullptr, если текстуру создать не удалось
+    sf::RenderTarget* begin(unsigned long long key, const sf::Vector2u& size, const sf::View& view);
+    void end();
+    
+    void render(sf::RenderTarget& target) const;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Achievement.h"
+#include "GameRecord.h"
+#include "GUI/Button.h"
+#include "GUI/ButtonBatch.h"
+#include "GUI/DrawableCache.h"
+
+// Сборка статичных экранов (вход, главное меню, рекорды, достижения).
+// Функции не знают о состоянии игры: цель, шрифт и данные приходят
+// параметрами, поэтому одними и теми же функциями пользуются Game и
+// tools/render_bench - бенчмарк меряет и сравнивает с эталоном тот же код.
+class Screens {
+public:
+    // Что показывают поля экрана входа
+    struct LoginView {
+        std::string username;
+        size_t passwordLength = 0;
+        bool usernameActive = false;
+        bool passwordActive = false;
+    };
+    
+    // Данные экрана достижений; achievements == nullptr - система не создана
+    struct AchievementsView {
+        const std::vector<Achievement>* achievements = nullptr;
+        std::string playerName;
+        int unlockedCount = 0;
+        int totalCount = 0;
+        int totalScore = 0;
+        float scrollOffset = 0.0f;
+    };
+    
+    // Экран входа: кнопки Login, Register, Play as Guest
+    static void setupLoginButtons(std::vector<Button>& buttons, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                  std::function<void()> onLogin, std::function<void()> onRegister,
+                                  std::function<void()> onGuest);
+    // Текст ошибки входа под кнопками; строку задает вызывающий
+    static void setupLoginErrorText(sf::Text& errorText, const sf::Font& font, const sf::Vector2u& canvasSize);
+    static void drawLogin(sf::RenderTarget& target, const sf::Font& font, const sf::Vector2u& canvasSize,
+                          const LoginView& view, const std::vector<Button>& buttons, ButtonBatch& batch,
+                          const sf::Text& errorText);
+    
+    // Главное меню: заголовок и пять кнопок; рисуется в ScreenLayer
+    static void setupTitle(sf::Text& title, const sf::Font& font);
+    static void setupMainMenuButtons(std::vector<Button>& buttons, const sf::Font& font,
+                                     std::function<void()> onNewGame, std::function<void()> onLeaderboard,
+                                     std::function<void()> onAchievements, std::function<void()> onSettings,
+                                     std::function<void()> onExit);
+    static void drawMainMenu(sf::RenderTarget& target, const sf::Text& title, const std::vector<Button>& buttons);
+    
+    // Кнопка "Back to Menu" внизу экранов рекордов и достижений
+    static void setupBackButton(std::vector<Button>& buttons, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                std::function<void()> onBack);
+    
+    // Статичное содержимое экранов рекордов и достижений, кнопки рисуются отдельно
+    static void buildLeaderboard(DrawableCache& cache, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                 const std::vector<GameRecord>& records);
+    static void buildAchievements(DrawableCache& cache, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                  const AchievementsView& view);
+};
+
+#endif
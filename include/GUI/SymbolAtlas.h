@@ -0,0 +1,47 @@
+#ifndef SYMBOLATLAS_H
+#define SYMBOLATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Растеризует текстовые символы карт (эмодзи, знаки, запасные "IMG1") в общий
+// атлас TextureAtlas. Каждый символ рисуется один раз на шрифт и размер вместе
+// с подложкой и тенью, после чего текстовые карты выводятся обычным квадом в
+// одной пачке с картинками. Если в основном шрифте нет глифа, ищется запасной.
+class SymbolAtlas {
+public:
+    static SymbolAtlas& getInstance();
+    
+    // Растеризует все символы темы одной пачкой (одна заливка атласа)
+    void preload(const std::vector<std::string>& symbols, const sf::Font& font, unsigned int characterSize);
+    
+    // Прямоугольник символа в TextureAtlas, при необходимости растеризует его
+    bool getRegion(const std::string& symbol, const sf::Font& font, unsigned int characterSize,
+                   sf::IntRect& region);
+    
+    // Освобождает холст и запасные шрифты - вызывается до закрытия окна
+    void clear();
+
+private:
+    SymbolAtlas();
+    SymbolAtlas(const SymbolAtlas&) = delete;
+    SymbolAtlas& operator=(const SymbolAtlas&) = delete;
+    
+    static std::string makeKey(const std::string& symbol, const sf::Font& font, unsigned int characterSize);
+    
+    bool rasterize(const std::string& symbol, const sf::Font& font, unsigned int characterSize,
+                   bool upload);
+    
+    // Первый шрифт (основной или запасной), в котором есть все глифы строки
+    const sf::Font& pickFont(const sf::String& text, const sf::Font& primary, unsigned int characterSize);
+    static bool hasGlyphs(const sf::Font& font, const sf::String& text, unsigned int characterSize);
+    void loadFallbackFonts();
+    
+    std::vector<const sf::Font*> fallbackFonts;  // Принадлежат FontManager
+    bool fallbacksLoaded;
+    std::unique_ptr<sf::RenderTexture> canvas;  // Создается при первой растеризации
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "GUI/ThumbnailCache.h"
+#include "GUI/ImagePrefetcher.h"
+
+// Общий на весь процесс кэш изображений карт.
+// Каждая картинка декодируется один раз, уменьшается до размера ячейки
+// и укладывается в одну большую текстуру-атлас. Карты ссылаются на
+// прямоугольник внутри атласа, поэтому обе карты пары и все новые игры
+// используют уже загруженные данные. Уменьшенные копии берутся из дискового
+// кэша миниатюр, а у текстуры строятся мипмапы для отдаленной камеры поля.
+// Края картинки продлены до границ ячейки, а глубина мипмапов ограничена
+// MAX_MIP_LEVEL, поэтому на отдалении карты не цепляют соседей и темную кайму.
+class TextureAtlas {
+public:
+    // Карта 80 px с картинкой на 80% и приближение камеры до 2x дают ~128 px
+    static const unsigned int CELL_SIZE = 128;
+    
+    // На уровне L билинейная выборка у края задевает полтексела = 2^(L-1) px
+    // базового уровня, отступ должен их покрывать. Ячейка кратна 2^L,
+    // поэтому блоки усреднения мипмапов не пересекают границы ячеек
+    static const unsigned int MAX_MIP_LEVEL = 3;
+    static const unsigned int CELL_PADDING = 1u << (MAX_MIP_LEVEL - 1);
+    
+    static TextureAtlas& getInstance();
+    
+    // Начинает декодировать картинки в фоне; preload/getRegion заберут готовые
+    void prefetch(const std::vector<std::string>& paths);
+    
+    // Загружает недостающие картинки одной пачкой (одна перезагрузка текстуры)
+    void preload(const std::vector<std::string>& paths);
+    
+    // Возвращает прямоугольник картинки в атласе, при необходимости загружает ее
+    bool getRegion(const std::string& path, sf::IntRect& region);
+    
+    // Ищет уже загруженную ячейку без обращения к диску
+    bool findRegion(const std::string& key, sf::IntRect& region) const;
+    
+    // Кладет готовое изображение (например, растеризованный символ) под ключом key.
+    // upload=false откладывает заливку на GPU до следующего flush/sync
+    bool addImage(const std::string& key, const sf::Image& image, bool upload = true);
+    
+    // Заливает на GPU ячейки, добавленные через addImage(..., false)
+    void flush();
+    
+    // Файл path изменился на диске: следующий preload/getRegion декодирует его
+    // заново в ту же ячейку, прежняя неудача загрузки забывается
+    void invalidate(const std::string& path);
+    
+    const sf::Texture& getTexture() const { return texture; }
+    size_t getImageCount() const { return cells.size(); }
+    
+    // Освобождает текстуру и останавливает фоновую загрузку - вызывается до закрытия окна
+    void clear();
+    
+private:
+    TextureAtlas();
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    
+    struct Cell {
+        sf::Image image;      // Вся ячейка с продленными краями - для перезаливки при росте атласа
+        sf::IntRect region;   // Положение картинки внутри атласа
+    };
+    
+    // Ячейка CELL_SIZE x CELL_SIZE: картинка со сдвигом CELL_PADDING,
+    // остаток заполнен ближайшими краевыми пикселями
+    static sf::Image extrudeToCell(const sf::Image& image);
+    
+    // Декодирует файл и кладет его в следующую свободную ячейку (без заливки на GPU)
+    bool addCell(const std::string& path);
+    
+    // Декодирует измененный файл заново на место его ячейки (без заливки на GPU)
+    bool reloadCell(const std::string& path);
+    
+    // Уменьшенная картинка файла: из фоновой предзагрузки или из кэша миниатюр
+    bool loadImage(const std::string& path, sf::Image& image);
+    
+    // Размещает изображение в следующей свободной ячейке
+    bool placeCell(const std::string& key, Cell cell);
+    unsigned int getMaxRows() const;
+    
+    // Досылает на GPU новые ячейки, при нехватке места пересоздает текстуру
+    void sync();
+    
+    sf::Texture texture;
+    ThumbnailCache thumbnails;
+    ImagePrefetcher prefetcher;
+    std::vector<Cell> cells;
+    std::unordered_map<std::string, size_t> indexByPath;
+    std::unordered_set<std::string> failedPaths;
+    std::unordered_set<std::string> stalePaths;  // Загружены, но файл с тех пор изменился
+    std::vector<size_t> dirtyCells;              // Залитые ячейки, перезаписанные reloadCell
+    unsigned int columns;        // Ячеек в строке атласа
+    unsigned int rowsAllocated;  // Строк в текущей текстуре
+    size_t uploadedCells;
+    size_t prefetchedCells;      // Ячеек, декодированных фоновыми потоками
+};
+
+#endif
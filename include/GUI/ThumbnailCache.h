@@ -0,0 +1,44 @@
+#ifndef THUMBNAILCACHE_H
+#define THUMBNAILCACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Дисковый кэш уменьшенных копий картинок карт.
+// Ключ - путь исходника, время его изменения, размер файла и размер миниатюры,
+// поэтому измененный исходник автоматически получает новую миниатюру,
+// а старая удаляется при записи новой.
+class ThumbnailCache {
+public:
+    explicit ThumbnailCache(const std::string& directory);
+    
+    // Загружает миниатюру со стороной не больше maxSide: из кэша или из исходника
+    bool load(const std::string& sourcePath, unsigned int maxSide, sf::Image& thumbnail);
+    
+    void setEnabled(bool value) { enabled = value; }
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+    
+    static sf::Image downscale(const sf::Image& source, unsigned int maxSide);
+    
+private:
+    // Имя файла: <хэш пути>_<хэш версии исходника и размера>.png
+    bool makeCachePath(const std::string& sourcePath, unsigned int maxSide,
+                       std::string& cachePath, std::string& pathPrefix) const;
+    void store(const std::string& cachePath, const std::string& pathPrefix, const sf::Image& thumbnail);
+    // Один раз читает папку кэша в cachedFiles
+    void scanDirectory();
+    
+    std::string directory;
+    // Префикс исходника -> имена его миниатюр на диске; папка читается
+    // один раз, дальше промах удаляет только файлы своего исходника
+    std::unordered_map<std::string, std::vector<std::string>> cachedFiles;
+    bool scanned;
+    bool enabled;
+    size_t hits;
+    size_t misses;
+};
+
+#endif
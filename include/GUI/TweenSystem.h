@@ -0,0 +1,42 @@
+#ifndef TWEENSYSTEM_H
+#define TWEENSYSTEM_H
+
+#include <vector>
+#include <cstddef>
+
+class CardSprite;
+
+// Анимации карт (переворот, пульсация при совпадении, появление).
+// Активные твины хранятся в параллельных массивах и продвигаются
+// одним проходом за кадр; без активных твинов update ничего не делает.
+class TweenSystem {
+public:
+    enum class Property {
+        Flip,   // Сжатие по X до нуля и обратно со сменой лица карты
+        Pulse,  // Кратковременное увеличение при совпадении пары
+        Fade    // Появление из прозрачности
+    };
+    
+    // Запускает твин; уже идущий твин того же свойства у карты перезапускается
+    void start(CardSprite* target, Property property, float duration, float delay = 0.0f);
+    
+    void update(float deltaTime);
+    
+    // Выставляет значения на aheadTime вперед, не продвигая твины. Нужно для
+    // отрисовки между фиксированными шагами логики: следующий update их перезапишет
+    void sample(float aheadTime);
+    void clear();
+    
+    bool isAnimating() const { return !targets.empty(); }
+    size_t getActiveCount() const { return targets.size(); }
+    
+private:
+    void removeAt(size_t index);
+    
+    std::vector<CardSprite*> targets;
+    std::vector<Property> properties;
+    std::vector<float> elapsed;    // Отрицательное значение - еще идет задержка
+    std::vector<float> durations;
+};
+
+#endif
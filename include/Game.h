@@ -12,15 +12,28 @@
 #include "Card.h"
 #include "Player.h"
 #include "Database.h"
+#include "LeaderboardService.h"
 #include "GUI/Button.h"
+#include "GUI/ButtonBatch.h"
 #include "GUI/CardSprite.h"
 #include "GUI/Menu.h"
+#include "GUI/DrawableCache.h"
+#include "GUI/ScreenLayer.h"
+#include "GUI/HudModel.h"
+#include "GUI/BoardRenderer.h"
+#include "GUI/TweenSystem.h"
+#include "GUI/ParticleSystem.h"
 #include "Audio/SoundManager.h"
 #include "Audio/MusicPlayer.h"
 #include "ContactForm.h"
 #include "Achievement.h"
 #include "UserManager.h"
+#include "Scheduler.h"
+#include "ThemeIndex.h"
+#include "FrameStats.h"
+#include "Profiler.h"
 #include <iomanip>
+#include <deque>
 
 enum class GameState {
     LOGIN_SCREEN,
@@ -43,23 +56,73 @@ enum class Difficulty {
     EASY,    // 3x4 = 12 cards (6 pairs)
     MEDIUM,  // 4x4 = 16 cards (8 pairs)
     HARD,    // 4x6 = 24 cards (12 pairs)
-    EXPERT   // 6x6 = 36 cards (18 pairs)
+    EXPERT,  // 6x6 = 36 cards (18 pairs)
+    CUSTOM   // Произвольный размер (MEMORY_GAME_CUSTOM_BOARD=<строки>x<столбцы>)
 };
 
 class Game {
 private:
+    // Логический холст: вся раскладка интерфейса задана в его координатах,
+    // окно любого размера показывает холст целиком с полосами по краям
+    static const unsigned int CANVAS_WIDTH = 1200;
+    static const unsigned int CANVAS_HEIGHT = 800;
+    
     sf::RenderWindow window;
-    sf::Font mainFont;
-    sf::Clock gameClock;
+    sf::View canvasView;
+    sf::Font& mainFont;  // Общий шрифт из FontManager
     sf::Time elapsedTime;
+    
+    // Игровой цикл: фиксированный шаг логики, отрисовка с частотой дисплея
+    bool useFixedTimestep;
+    float fixedTimestep;
+    float maxFrameTime;
+    float interpolationAlpha;
+    FrameStats frameStats;
+    
+    // Перерисовка по требованию для статичных экранов
+    bool idleRendering;
+    bool needsRedraw;
+    GameState lastRenderedState;
+    sf::Time idleWaitTimeout;
+    
+    // Профайлер кадра: оверлей по F3, трасса через MEMORY_GAME_PROFILE_TRACE
+    Profiler profiler;
+    sf::Text profilerText;
+    sf::RectangleShape profilerBackground;
+    sf::Clock profilerHudClock;
+    
+    // Готовые элементы динамических экранов, пересобираются при смене данных
+    DrawableCache leaderboardCache;
+    std::vector<GameRecord> cachedLeaderboard;
+    unsigned int cachedLeaderboardVersion;
+    DrawableCache achievementsCache;
+    DrawableCache gameOverCache;
+    GameState gameOverCacheState;
+    sf::RectangleShape* gameOverButton;
+    DrawableCache pauseCache;
+    // Статичная часть текущего меню (MAIN_MENU, SETUP, SETTINGS), отрисованная в текстуру
+    ScreenLayer menuLayer;
 
     Database db;
 
     std::unique_ptr<UserManager> userManager;
 
     std::vector<std::unique_ptr<CardSprite>> cards;
+    BoardRenderer boardRenderer;
+    BoardLayout boardLayout;
+    // Камера игрового поля (панорамирование и масштаб для больших полей)
+    sf::View boardView;
+    float boardMaxZoom;
+    bool isPanningBoard;
+    sf::Vector2i lastPanPosition;
+    int customRows, customCols;
+    TweenSystem cardTweens;
+    // Вспышки совпавших пар (координаты поля) и салют на экране победы (координаты окна)
+    ParticleSystem matchParticles;
+    ParticleSystem victoryParticles;
     std::unique_ptr<Player> player;
     std::unique_ptr<Database> database;
+    std::unique_ptr<LeaderboardService> leaderboardService;
     std::unique_ptr<SoundManager> soundManager;
     std::unique_ptr<MusicPlayer> musicPlayer;
     std::unique_ptr<AchievementManager> achievementManager;
@@ -98,6 +161,9 @@ private:
     std::vector<Button> settingsButtons;
     std::vector<Button> achievementsButtons;
     Button surrenderButton;
+    // Кнопки экрана рисуются пачкой; наведение обновляется по MouseMoved
+    ButtonBatch buttonBatch;
+    GameState hoverState;
 
     float brightness;
     sf::VideoMode currentVideoMode;
@@ -110,6 +176,7 @@ private:
     sf::Text scoreText;
     sf::Text difficultyText;
     sf::Text settingsTitle;
+    HudModel hudModel;
     
     GameState currentState;
     GameState previousState;
@@ -125,6 +192,13 @@ private:
     float cardFlipTime;
     float cardFlipProgress;
     bool isFlipping;
+    float mismatchDelay;
+    
+    // Отложенные действия (скрытие карт, смена состояний, таймауты)
+    Scheduler scheduler;
+    ThemeIndex themeIndex;  // Картинки папок тем, обновляются по событиям inotify
+    // Клики по картам, сделанные во время переворота/проверки пары
+    std::deque<int> queuedCardClicks;
 
     CardSprite* firstCard;
     CardSprite* secondCard;
@@ -150,6 +224,25 @@ private:
     ContactForm contactForm;
 
     void updateBackgrounds();
+    
+    // Виртуальное разрешение: холст вписывается в окно через область вывода вида
+    void applyCanvasViewport(unsigned int width, unsigned int height);
+    sf::Vector2u getCanvasSize() const;
+    sf::Vector2u getCanvasPixelSize() const;
+    // Область холста под поле карт: под заголовком, между колонкой HUD слева
+    // и кнопками справа. Камера поля выводится только в нее
+    sf::FloatRect getBoardArea() const;
+    sf::Vector2f getCanvasMousePosition() const;
+    
+    sf::Color applyBrightness(const sf::Color& color) const;
+    void applyFrameRateMode();
+    void runFixedTimestep();
+    void reportFrameStats();
+    bool isStaticScreen(GameState state) const;
+    bool canIdle() const;
+    void waitForActivity();
+    bool isRedrawNeeded() const;
+    void processEvent(const sf::Event& event, const sf::Vector2f& mousePos);
     void loadResources();
     void setupLoginUI();
     void setupRegisterUI();
@@ -162,10 +255,24 @@ private:
     void setupAchievementsUI();
     void setupContactForm();
     void initializeCards();
+    void getBoardSize(Difficulty diff, int& boardRows, int& boardCols) const;
+    std::string getThemeImageDir(CardTheme theme) const;
+    // Фоновое декодирование картинок для выбранных в настройках темы и сложности
+    void prefetchCardImages();
     void createCardSprites();
     void resetGame();
     void updateStats();
+    
+    // Камера игрового поля
+    void setupBoardView();
+    bool isBoardViewMovable() const;
+    bool handleBoardViewEvent(const sf::Event& event);
+    void zoomBoardView(float factor, const sf::Vector2i& pixel);
+    void clampBoardView();
+    BoardLayout::Range getVisibleBoardRange() const;
     void handleCardClick(int cardIndex);
+    void queueCardClick(int cardIndex);
+    void processQueuedClicks();
     void processCardMatch();
     void saveGameResult();
     void checkAchievements();
@@ -177,12 +284,25 @@ private:
     void renderAchievements();
     void renderGame();
     void renderMainMenu();
+    bool isLayeredScreen(GameState state) const;
+    unsigned long long getMenuLayerKey(const std::vector<Button>& buttons) const;
+    void renderMenuLayer(const std::vector<Button>& buttons,
+                         const std::function<void(sf::RenderTarget&)>& drawStatic);
     void renderPauseMenu();
+    std::vector<Button>* getScreenButtons(GameState state);
+    void updateButtonHover(const sf::Vector2f& mousePos);
+    void releaseButtons(const sf::Vector2f& mousePos, const sf::Event& event);
     void renderSetupMenu();
     void renderGameOverWin();
     void renderGameOverLose();
     void renderLeaderboard();
     void renderSettings();
+    void renderProfilerHud();
+    
+    void invalidateScreenCaches();
+    void rebuildLeaderboardCache();
+    void rebuildAchievementsCache();
+    void addGameOverButton(const std::string& label);
 
     std::string getDifficultyString() const;
     std::string getCurrentDate() const;
@@ -204,6 +324,7 @@ public:
     void handleEvents();
     void update(float deltaTime);
     void render();
+    void markDirty() { needsRedraw = true; }
 
     void startNewGame();
     void pauseGame();
@@ -217,6 +338,7 @@ public:
     void setTheme(CardTheme theme);
 
     GameState getState() const { return currentState; }
+    float getInterpolationAlpha() const { return interpolationAlpha; }
     int getScore() const { return player ? player->getScore() : 0; }
     sf::Font& getMainFont() { return mainFont; }
 };
@@ -0,0 +1,18 @@
+#ifndef GAMERECORD_H
+#define GAMERECORD_H
+
+#include <string>
+
+// Результат одной партии - строка таблицы рекордов
+struct GameRecord {
+    int id;
+    std::string playerName;
+    int score;
+    int moves;
+    int pairs;
+    double time;
+    std::string date;
+    std::string difficulty;
+};
+
+#endif
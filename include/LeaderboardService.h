@@ -0,0 +1,56 @@
+#ifndef LEADERBOARDSERVICE_H
+#define LEADERBOARDSERVICE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Database.h"
+
+// Снимок таблицы лидеров, обновляемый в фоновом потоке.
+// Отрисовка берет последний удачный снимок и не ждет PostgreSQL.
+// Поток держит собственное подключение: PGconn нельзя делить между потоками.
+class LeaderboardService {
+private:
+    Database database;
+    int limit;
+    std::chrono::seconds ttl;
+    std::chrono::seconds retryDelay;      // Удваивается после каждой неудачи, до maxRetryDelay
+    std::chrono::seconds maxRetryDelay;
+    bool failing;                         // Последнее обновление не удалось - предупреждение уже в логе
+    
+    mutable std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::thread worker;
+    bool stopRequested;
+    bool refreshRequested;
+    
+    std::vector<GameRecord> snapshot;
+    unsigned int version;
+    bool hasData;
+    
+    void workerLoop();
+    
+public:
+    LeaderboardService(const std::string& connStr, int limit = 10,
+                       std::chrono::seconds ttl = std::chrono::seconds(30));
+    ~LeaderboardService();
+    
+    LeaderboardService(const LeaderboardService&) = delete;
+    LeaderboardService& operator=(const LeaderboardService&) = delete;
+    
+    void start();
+    void stop();
+    
+    // Сбрасывает снимок: поток перечитает таблицу без ожидания TTL
+    void invalidate();
+    
+    // Версия растет, только когда новый снимок отличается от прежнего
+    unsigned int getVersion() const;
+    std::vector<GameRecord> getSnapshot() const;
+    bool hasSnapshot() const;
+};
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+// Уровни логирования (порядок важен - сравниваются как числа)
+enum class LogLevel {
+    Debug = 0,
+    Info = 1,
+    Warning = 2,
+    Error = 3
+};
+
+// Минимальный уровень, который вообще попадает в бинарник.
+// В релизной сборке (NDEBUG) отладочные сообщения вырезаются на этапе компиляции.
+// Можно переопределить через -DMEMORY_GAME_MIN_LOG_LEVEL=<0..3>
+#ifndef MEMORY_GAME_MIN_LOG_LEVEL
+#ifdef NDEBUG
+#define MEMORY_GAME_MIN_LOG_LEVEL 1
+#else
+#define MEMORY_GAME_MIN_LOG_LEVEL 0
+#endif
+#endif
+
+// Одна строка лога. Текст собирается в фиксированный буфер без выделений памяти,
+// префикс (время, уровень, категория) и вывод делает фоновый поток
+class LogLine {
+public:
+    static const size_t MAX_LENGTH = 240;
+    
+    LogLine(LogLevel level, const char* category);
+    
+    LogLine& operator<<(const char* text);
+    LogLine& operator<<(const std::string& text);
+    LogLine& operator<<(char c);
+    LogLine& operator<<(bool value);
+    LogLine& operator<<(double value);
+    LogLine& operator<<(long long value);
+    LogLine& operator<<(unsigned long long value);
+    
+    template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+    LogLine& operator<<(T value) { return *this << static_cast<long long>(value); }
+    
+    template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+    LogLine& operator<<(T value) { return *this << static_cast<unsigned long long>(value); }
+    
+    LogLine& operator<<(float value) { return *this << static_cast<double>(value); }
+    
+    LogLevel getLevel() const { return level; }
+    const char* getCategory() const { return category; }
+    const char* getText() const { return text; }
+    size_t getLength() const { return length; }
+
+private:
+    void append(const char* data, size_t size);
+    
+    LogLevel level;
+    const char* category;
+    char text[MAX_LENGTH];
+    size_t length;
+};
+
+// Асинхронный логгер: производители кладут строки в lock-free кольцевой буфер,
+// форматирование префикса и запись в stdout/stderr идут в фоновом потоке.
+// Пустой буфер поток ждет на условной переменной; будит его только тот
+// производитель, который застал его спящим. Порядок строк гарантирован лишь
+// между LOG_*: прямой вывод в std::cout/std::cerr может перемешаться с ними
+class Logger {
+public:
+    static Logger& getInstance();
+    
+    // Сообщение ниже runtime-уровня отбрасывается до сборки текста
+    bool isEnabled(LogLevel messageLevel) const {
+        return static_cast<int>(messageLevel) >= minLevel.load(std::memory_order_relaxed);
+    }
+    
+    void submit(const LogLine& line);
+    void setLevel(LogLevel newLevel);
+    
+    // Дописывает все накопленные строки и останавливает поток
+    void shutdown();
+    
+    size_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+    
+    static const char* levelName(LogLevel level);
+
+private:
+    Logger();
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+    
+    static const size_t CAPACITY = 1024;  // Степень двойки
+    
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        const char* category;
+        std::chrono::system_clock::time_point timestamp;
+        char text[LogLine::MAX_LENGTH];
+        size_t length;
+    };
+    
+    bool writeNext();
+    bool hasPending() const;
+    void writerLoop();
+    void wakeWriter();
+    void writeSlot(const Slot& slot);
+    
+    Slot* slots;
+    std::atomic<size_t> enqueuePos;
+    size_t dequeuePos;  // Читает только фоновый поток
+    
+    std::atomic<int> minLevel;
+    std::atomic<size_t> dropped;
+    std::atomic<bool> accepting;          // Принимает ли очередь новые строки
+    std::atomic<size_t> activeProducers;  // Потоки внутри submit()
+    std::atomic<bool> running;            // Работает ли фоновый поток
+    std::atomic<bool> writerSleeping;     // Поток ждет на wakeUp - первая строка должна его разбудить
+    std::mutex wakeMutex;
+    std::condition_variable wakeUp;
+    std::thread writer;
+};
+
+#define LOG_AT(level, category, message) \
+    do { \
+        if (Logger::getInstance().isEnabled(level)) { \
+            LogLine logLine_(level, category); \
+            logLine_ << message; \
+            Logger::getInstance().submit(logLine_); \
+        } \
+    } while (0)
+
+#if MEMORY_GAME_MIN_LOG_LEVEL <= 0
+#define LOG_DEBUG(category, message) LOG_AT(LogLevel::Debug, category, message)
+#else
+#define LOG_DEBUG(category, message) do {} while (0)
+#endif
+
+#if MEMORY_GAME_MIN_LOG_LEVEL <= 1
+#define LOG_INFO(category, message) LOG_AT(LogLevel::Info, category, message)
+#else
+#define LOG_INFO(category, message) do {} while (0)
+#endif
+
+#if MEMORY_GAME_MIN_LOG_LEVEL <= 2
+#define LOG_WARNING(category, message) LOG_AT(LogLevel::Warning, category, message)
+#else
+#define LOG_WARNING(category, message) do {} while (0)
+#endif
+
+#define LOG_ERROR(category, message) LOG_AT(LogLevel::Error, category, message)
+
+#endif
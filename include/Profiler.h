@@ -0,0 +1,120 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Покадровый профайлер игрового цикла.
+// Замеряет именованные участки кадра, хранит скользящее окно последних
+// кадров для p50/p95/p99 и пишет трассу в CSV или JSON (chrome://tracing).
+class Profiler {
+public:
+    using ClockType = std::chrono::steady_clock;
+    
+    struct SectionStats {
+        std::string name;
+        float lastMs;
+        float p50Ms;
+        float p95Ms;
+        float p99Ms;
+        float worstMs;
+    };
+    
+private:
+    struct Section {
+        const char* name;
+        std::vector<float> samples; // кольцевой буфер, мс
+        size_t nextSample;
+        size_t sampleCount;
+        float frameMs;              // накоплено за текущий кадр
+        float worstMs;
+        bool touched;               // участок выполнялся в текущем кадре
+    };
+    
+    enum class TraceFormat { NONE, CSV, JSON };
+    
+    bool enabled;
+    bool hudVisible;
+    size_t windowSize;
+    
+    // Имена участков - строковые литералы, поэтому ключ - указатель
+    std::map<const char*, size_t> sectionIndex;
+    std::vector<Section> sections;
+    Section frameSection;
+    
+    uint64_t frameNumber;
+    ClockType::time_point frameStart;
+    ClockType::time_point traceStart;
+    
+    float worstFrameMs;
+    uint64_t worstFrameNumber;
+    std::vector<std::pair<const char*, float>> worstFrameBreakdown;
+    
+    std::ofstream traceFile;
+    TraceFormat traceFormat;
+    bool traceHasEvents;
+    
+    size_t getSectionIndex(const char* name);
+    void pushSample(Section& section, float ms);
+    SectionStats computeStats(const Section& section) const;
+    void writeTraceEvent(const char* name, ClockType::time_point start, float durationMs);
+    void updateEnabled();
+    
+public:
+    Profiler(size_t windowSize = 240);
+    ~Profiler();
+    
+    bool openTrace(const std::string& path);
+    void closeTrace();
+    bool isTracing() const { return traceFormat != TraceFormat::NONE; }
+    
+    void toggleHud() { hudVisible = !hudVisible; updateEnabled(); }
+    bool isHudVisible() const { return hudVisible; }
+    bool isEnabled() const { return enabled; }
+    
+    void beginFrame();
+    void endFrame();
+    void addSample(const char* name, ClockType::time_point start, ClockType::time_point end);
+    
+    SectionStats getFrameStats() const { return computeStats(frameSection); }
+    std::vector<SectionStats> getSectionStats() const;
+    std::string buildSummary() const;
+};
+
+// Замер участка кадра на время жизни объекта
+class ProfileScope {
+private:
+    Profiler& profiler;
+    const char* name;
+    Profiler::ClockType::time_point start;
+    bool active;
+    
+public:
+    ProfileScope(Profiler& profiler, const char* name)
+        : profiler(profiler), name(name), active(profiler.isEnabled()) {
+        if (active) {
+            start = Profiler::ClockType::now();
+        }
+    }
+    
+    ~ProfileScope() {
+        stop();
+    }
+    
+    // Досрочно завершает замер
+    void stop() {
+        if (active) {
+            profiler.addSample(name, start, Profiler::ClockType::now());
+            active = false;
+        }
+    }
+    
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <functional>
+#include <vector>
+
+// Планировщик отложенных действий, работающий от игрового цикла.
+// Время продвигается только через update(deltaTime), поэтому задержки
+// не блокируют поток и останавливаются вместе с обновлением игры.
+class Scheduler {
+public:
+    using TaskId = unsigned int;
+    
+private:
+    struct Task {
+        TaskId id;
+        float remaining;
+        std::function<void()> action;
+    };
+    
+    std::vector<Task> tasks;
+    TaskId nextId;
+    
+public:
+    Scheduler();
+    
+    TaskId schedule(float delaySeconds, std::function<void()> action);
+    bool cancel(TaskId id);
+    void clear();
+    
+    void update(float deltaTime);
+    
+    bool isPending(TaskId id) const;
+    bool isEmpty() const { return tasks.empty(); }
+    size_t getPendingCount() const { return tasks.size(); }
+};
+
+#endif
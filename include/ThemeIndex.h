@@ -0,0 +1,51 @@
+#ifndef THEMEINDEX_H
+#define THEMEINDEX_H
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Список картинок по папкам тем, хранящийся в памяти.
+// Папка сканируется один раз поверх индекса архива ресурсов (файл на диске,
+// измененный после сборки архива, заменяет одноименный из него), дальше за ней
+// следит inotify: новые, удаленные и перезаписанные файлы помечают запись
+// устаревшей, и она пересобирается при следующем запросе. Без изменений старт игры не обращается к файловой системе вовсе.
+// Там, где inotify недоступен, папка сканируется при каждом запросе.
+class ThemeIndex {
+public:
+    ThemeIndex();
+    ~ThemeIndex();
+    
+    ThemeIndex(const ThemeIndex&) = delete;
+    ThemeIndex& operator=(const ThemeIndex&) = delete;
+    
+    // Картинки папки темы в порядке имен
+    const std::vector<std::string>& getImages(const std::string& imageDir);
+    
+    static bool isImageFile(const std::string& path);
+    
+    // Вызывается для каждой картинки, содержимое которой сменилось на диске
+    // (перезаписана, заменена, удалена), - чтобы сбросить ее декодированные копии
+    void setChangeHandler(std::function<void(const std::string&)> handler) { onFileChanged = std::move(handler); }
+
+private:
+    struct Entry {
+        std::vector<std::string> images;
+        bool valid = false;
+        bool watched = false;  // Без наблюдения запись пересобирается каждый раз
+    };
+    
+    // Забирает накопившиеся события inotify без ожидания
+    void readEvents();
+    void onImageEvent(const std::string& path, unsigned int mask);
+    void scan(const std::string& imageDir, Entry& entry);
+    bool watch(const std::string& directory);
+    
+    int inotifyFd;
+    std::unordered_map<std::string, Entry> entries;
+    std::unordered_map<int, std::string> watches;  // Дескриптор наблюдения -> папка
+    std::function<void(const std::string&)> onFileChanged;
+};
+
+#endif
@@ -0,0 +1,149 @@
+#include "AssetPack.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+AssetPack& AssetPack::getInstance() {
+    static AssetPack instance;
+    return instance;
+}
+
+AssetPack::AssetPack() : mapping(nullptr), mappingSize(0) {
+    const char* packEnv = std::getenv("MEMORY_GAME_ASSET_PACK");
+    open(packEnv ? packEnv : "assets.pack");
+}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+bool AssetPack::open(const std::string& packPath) {
+    path = packPath;
+    
+    int fd = ::open(packPath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_INFO("assets", "Архив ресурсов не найден (" << packPath << "), ресурсы читаются из файлов");
+        return false;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(PackHeader))) {
+        ::close(fd);
+        LOG_WARNING("assets", "Поврежденный архив ресурсов: " << packPath);
+        return false;
+    }
+    
+    mappingSize = static_cast<std::size_t>(info.st_size);
+    void* data = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Отображение живет и после закрытия дескриптора
+    ::close(fd);
+    
+    if (data == MAP_FAILED) {
+        LOG_WARNING("assets", "Не удалось отобразить архив ресурсов: " << packPath);
+        mappingSize = 0;
+        return false;
+    }
+    mapping = data;
+    
+    const char* base = static_cast<const char*>(mapping);
+    PackHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 || header.version != PACK_VERSION ||
+        header.indexOffset > mappingSize || header.indexSize > mappingSize - header.indexOffset) {
+        LOG_WARNING("assets", "Неверный формат архива ресурсов: " << packPath);
+        close();
+        return false;
+    }
+    
+    // Разбираем индекс, проверяя каждую запись на выход за границы файла
+    const char* cursor = base + header.indexOffset;
+    const char* indexEnd = cursor + header.indexSize;
+    entries.reserve(header.entryCount);
+    sortedNames.reserve(header.entryCount);
+    
+    for (std::uint32_t i = 0; i < header.entryCount; i++) {
+        PackIndexEntry record;
+        bool truncated = static_cast<std::size_t>(indexEnd - cursor) < sizeof(record);
+        if (!truncated) {
+            std::memcpy(&record, cursor, sizeof(record));
+            cursor += sizeof(record);
+        }
+        
+        // Оборванный индекс - такой же брак, как запись за пределами файла:
+        // иначе часть ресурсов молча пропала бы из архива
+        if (truncated || static_cast<std::size_t>(indexEnd - cursor) < record.nameLength ||
+            record.offset > mappingSize || record.size > mappingSize - record.offset) {
+            LOG_WARNING("assets", "Поврежденный индекс архива ресурсов: " << packPath);
+            close();
+            return false;
+        }
+        
+        std::string name(cursor, record.nameLength);
+        cursor += record.nameLength;
+        
+        entries[name] = Entry{base + record.offset, static_cast<std::size_t>(record.size), record.hash};
+        sortedNames.push_back(name);
+    }
+    
+    std::sort(sortedNames.begin(), sortedNames.end());
+    
+    // Страницы подгружаются по мере чтения; подсказываем ядру, что архив нужен целиком
+    madvise(mapping, mappingSize, MADV_WILLNEED);
+    
+    LOG_INFO("assets", "📦 Архив ресурсов: " << packPath << " (" << entries.size() << " файлов, "
+             << (mappingSize / 1024) << " КБ)");
+    return true;
+}
+
+void AssetPack::close() {
+    if (mapping) {
+        munmap(mapping, mappingSize);
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    entries.clear();
+    sortedNames.clear();
+    overridden.clear();
+}
+
+const AssetPack::Entry* AssetPack::find(const std::string& name) const {
+    auto it = entries.find(name);
+    if (it == entries.end()) return nullptr;
+    
+    std::shared_lock<std::shared_mutex> lock(overrideMutex);
+    return overridden.count(name) ? nullptr : &it->second;
+}
+
+void AssetPack::setOverridden(const std::string& name, bool enabled) {
+    if (!entries.count(name)) return;
+    
+    std::unique_lock<std::shared_mutex> lock(overrideMutex);
+    if (enabled) {
+        if (overridden.insert(name).second) {
+            LOG_DEBUG("assets", "Файл на диске заменяет копию из архива: " << name);
+        }
+    } else {
+        overridden.erase(name);
+    }
+}
+
+std::vector<std::string> AssetPack::list(const std::string& directory) const {
+    std::string prefix = directory;
+    if (!prefix.empty() && prefix.back() != '/') prefix += '/';
+    
+    std::vector<std::string> result;
+    for (auto it = std::lower_bound(sortedNames.begin(), sortedNames.end(), prefix);
+         it != sortedNames.end() && it->compare(0, prefix.size(), prefix) == 0; ++it) {
+        if (it->find('/', prefix.size()) == std::string::npos) {
+            result.push_back(*it);
+        }
+    }
+    return result;
+}
@@ -1,4 +1,5 @@
 #include "Audio/MusicPlayer.h"
+#include "AssetPack.h"
 #include <iostream>
 
 MusicPlayer::MusicPlayer() : volume(50.0f), isPlaying(false) {
@@ -27,8 +28,12 @@ void MusicPlayer::play(MusicTheme theme) {
             currentMusic.stop();
         }
         
-        // Загружаем и играем новую
-        if (currentMusic.openFromFile(it->second)) {
+        // Загружаем и играем новую. sf::Music читает поток по ходу игры,
+        // поэтому из архива берем только отображенную память - она живет до выхода
+        const AssetPack::Entry* packed = AssetPack::getInstance().find(it->second);
+        bool opened = packed ? currentMusic.openFromMemory(packed->data, packed->size)
+                             : currentMusic.openFromFile(it->second);
+        if (opened) {
             currentMusic.setVolume(volume);
             currentMusic.setLoop(true);
             currentMusic.play();
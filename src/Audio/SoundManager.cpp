@@ -1,4 +1,6 @@
 #include "Audio/SoundManager.h"
+#include "Logger.h"
+#include "AssetPack.h"
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -25,18 +27,25 @@ SoundManager::SoundManager() : volume(50.0f), soundEnabled(true) {
     for (const auto& [soundName, filePath] : soundFiles) {
         std::cout << "  🔍 " << soundName << " -> " << filePath;
         
+        // Звук из архива ресурсов декодируется прямо из отображенной памяти
+        const AssetPack::Entry* packed = AssetPack::getInstance().find(filePath);
+        
         // Проверяем существует ли файл
-        std::ifstream testFile(filePath, std::ios::binary);
-        if (!testFile.is_open()) {
-            std::cout << " ❌ ФАЙЛ НЕ НАЙДЕН" << std::endl;
-            createFallbackSound(soundName);
-            continue;
+        if (!packed) {
+            std::ifstream testFile(filePath, std::ios::binary);
+            if (!testFile.is_open()) {
+                std::cout << " ❌ ФАЙЛ НЕ НАЙДЕН" << std::endl;
+                createFallbackSound(soundName);
+                continue;
+            }
+            testFile.close();
         }
-        testFile.close();
         
         // Пробуем загрузить через SFML
         sf::SoundBuffer buffer;
-        if (buffer.loadFromFile(filePath)) {
+        bool loaded = packed ? buffer.loadFromMemory(packed->data, packed->size)
+                             : buffer.loadFromFile(filePath);
+        if (loaded) {
             // Успешно загрузили из файла
             soundBuffers[soundName] = buffer;
             
@@ -142,7 +151,11 @@ void SoundManager::createProgrammaticSound(const std::string& name, float freque
 bool SoundManager::loadSound(const std::string& name, const std::string& filepath) {
     sf::SoundBuffer buffer;
     
-    if (buffer.loadFromFile(filepath)) {
+    const AssetPack::Entry* packed = AssetPack::getInstance().find(filepath);
+    bool loaded = packed ? buffer.loadFromMemory(packed->data, packed->size)
+                         : buffer.loadFromFile(filepath);
+    
+    if (loaded) {
         soundBuffers[name] = buffer;
         
         sf::Sound sound;
@@ -166,7 +179,7 @@ void SoundManager::playSound(const std::string& name) {
             it->second.stop();
         }
         it->second.play();
-        std::cout << "[PLAY] " << name << std::endl;
+        LOG_DEBUG("audio", "[PLAY] " << name);
     }
 }
 
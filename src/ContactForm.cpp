@@ -1,19 +1,19 @@
 #include "ContactForm.h"
 #include <iostream>
 
-ContactForm::ContactForm() : activeField(ActiveField::NONE) {
+ContactForm::ContactForm() : font(nullptr), activeField(ActiveField::NONE) {
     nameInput = "";
     emailInput = "";
     messageInput = "";
 }
 
-bool ContactForm::loadFont(const std::string& fontPath) {
-    return font.loadFromFile(fontPath);
+void ContactForm::setFont(const sf::Font& sharedFont) {
+    font = &sharedFont;
 }
 
 void ContactForm::setup(float windowWidth, float windowHeight) {
     // Настройка шрифтов
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("Contact Developer");
     titleText.setCharacterSize(48);
     titleText.setFillColor(sf::Color::White);
@@ -21,19 +21,19 @@ void ContactForm::setup(float windowWidth, float windowHeight) {
     titleText.setPosition(windowWidth / 2 - 150, 50);
     
     // Надписи полей
-    nameLabel.setFont(font);
+    nameLabel.setFont(*font);
     nameLabel.setString("Your Name:");
     nameLabel.setCharacterSize(28);
     nameLabel.setFillColor(sf::Color::White);
     nameLabel.setPosition(100, 150);
     
-    emailLabel.setFont(font);
+    emailLabel.setFont(*font);
     emailLabel.setString("Your Email:");
     emailLabel.setCharacterSize(28);
     emailLabel.setFillColor(sf::Color::White);
     emailLabel.setPosition(100, 250);
     
-    messageLabel.setFont(font);
+    messageLabel.setFont(*font);
     messageLabel.setString("Your Message:");
     messageLabel.setCharacterSize(28);
     messageLabel.setFillColor(sf::Color::White);
@@ -65,7 +65,7 @@ void ContactForm::setup(float windowWidth, float windowHeight) {
     sendButton.setOutlineColor(sf::Color::White);
     sendButton.setPosition(windowWidth / 2 - 220, 600);
     
-    sendButtonText.setFont(font);
+    sendButtonText.setFont(*font);
     sendButtonText.setString("Save Feedback");
     sendButtonText.setCharacterSize(24);
     sendButtonText.setFillColor(sf::Color::White);
@@ -78,14 +78,14 @@ void ContactForm::setup(float windowWidth, float windowHeight) {
     backButton.setOutlineColor(sf::Color::White);
     backButton.setPosition(windowWidth / 2 + 20, 600);
     
-    backButtonText.setFont(font);
+    backButtonText.setFont(*font);
     backButtonText.setString("Back to Menu");
     backButtonText.setCharacterSize(24);
     backButtonText.setFillColor(sf::Color::White);
     backButtonText.setPosition(windowWidth / 2 + 60, 610);
     
     // Статус
-    statusText.setFont(font);
+    statusText.setFont(*font);
     statusText.setString("");
     statusText.setCharacterSize(20);
     statusText.setFillColor(sf::Color::Yellow);
@@ -198,17 +198,17 @@ void ContactForm::render(sf::RenderWindow& window) {
     window.draw(backButtonText);
     
     // Отрисовка введенного текста
-    sf::Text nameDisplay(nameInput + (activeField == ActiveField::NAME ? "_" : ""), font, 24);
+    sf::Text nameDisplay(nameInput + (activeField == ActiveField::NAME ? "_" : ""), *font, 24);
     nameDisplay.setFillColor(sf::Color::White);
     nameDisplay.setPosition(305, 155);
     window.draw(nameDisplay);
     
-    sf::Text emailDisplay(emailInput + (activeField == ActiveField::EMAIL ? "_" : ""), font, 24);
+    sf::Text emailDisplay(emailInput + (activeField == ActiveField::EMAIL ? "_" : ""), *font, 24);
     emailDisplay.setFillColor(sf::Color::White);
     emailDisplay.setPosition(305, 255);
     window.draw(emailDisplay);
     
-    sf::Text messageDisplay(messageInput + (activeField == ActiveField::MESSAGE ? "_" : ""), font, 24);
+    sf::Text messageDisplay(messageInput + (activeField == ActiveField::MESSAGE ? "_" : ""), *font, 24);
     messageDisplay.setFillColor(sf::Color::White);
     messageDisplay.setPosition(305, 355);
     window.draw(messageDisplay);
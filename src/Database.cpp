@@ -195,6 +195,12 @@ bool Database::saveGame(const GameRecord& record) {
 
 std::vector<GameRecord> Database::getTopScores(int limit) {
     std::vector<GameRecord> records;
+    fetchTopScores(limit, records);
+    return records;
+}
+
+bool Database::fetchTopScores(int limit, std::vector<GameRecord>& records) {
+    records.clear();
     
     std::string query = 
         "SELECT id, player_name, score, moves, pairs, time, "
@@ -213,7 +219,7 @@ std::vector<GameRecord> Database::getTopScores(int limit) {
     if (PQresultStatus(result) != PGRES_TUPLES_OK) {
         logError("Get top scores");
         PQclear(result);
-        return records;
+        return false;
     }
     
     int rowCount = PQntuples(result);
@@ -232,7 +238,7 @@ std::vector<GameRecord> Database::getTopScores(int limit) {
     }
     
     PQclear(result);
-    return records;
+    return true;
 }
 
 std::vector<GameRecord> Database::getPlayerHistory(const std::string& playerName, int limit) {
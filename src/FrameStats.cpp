@@ -0,0 +1,72 @@
+#include "FrameStats.h"
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+
+FrameStats::FrameStats(float reportInterval)
+    : reportInterval(reportInterval), targetFrameTime(1.0f / 60.0f) {
+    reset();
+}
+
+void FrameStats::addFrame(float frameSeconds, int steps, int dropped) {
+    windowTime += frameSeconds;
+    frameCount++;
+    simulationSteps += steps;
+    droppedSteps += dropped;
+    
+    minFrameTime = std::min(minFrameTime, frameSeconds);
+    maxFrameTime = std::max(maxFrameTime, frameSeconds);
+    sumFrameTime += frameSeconds;
+    sumSquaredFrameTime += static_cast<double>(frameSeconds) * frameSeconds;
+    
+    // Рывок - кадр длиннее двух целевых
+    if (frameSeconds > targetFrameTime * 2.0f) {
+        hitchCount++;
+    }
+}
+
+float FrameStats::getAverageFrameTime() const {
+    return frameCount > 0 ? static_cast<float>(sumFrameTime / frameCount) : 0.0f;
+}
+
+float FrameStats::getJitter() const {
+    if (frameCount < 2) return 0.0f;
+    
+    double mean = sumFrameTime / frameCount;
+    double variance = sumSquaredFrameTime / frameCount - mean * mean;
+    return static_cast<float>(std::sqrt(std::max(0.0, variance)));
+}
+
+std::string FrameStats::buildReport() const {
+    float avg = getAverageFrameTime();
+    
+    std::stringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << "[FRAME] " << frameCount << " frames in " << windowTime << "s"
+           << " | fps " << (avg > 0.0f ? 1.0f / avg : 0.0f)
+           << " | avg " << avg * 1000.0f << "ms"
+           << " min " << minFrameTime * 1000.0f << "ms"
+           << " max " << maxFrameTime * 1000.0f << "ms"
+           << " jitter " << getJitter() * 1000.0f << "ms"
+           << " | hitches " << hitchCount
+           << " | sim steps " << simulationSteps;
+    
+    if (droppedSteps > 0) {
+        report << " (dropped " << droppedSteps << ")";
+    }
+    
+    return report.str();
+}
+
+void FrameStats::reset() {
+    windowTime = 0.0f;
+    frameCount = 0;
+    simulationSteps = 0;
+    droppedSteps = 0;
+    hitchCount = 0;
+    minFrameTime = 1e9f;
+    maxFrameTime = 0.0f;
+    sumFrameTime = 0.0;
+    sumSquaredFrameTime = 0.0;
+}
@@ -0,0 +1,58 @@
+#include "GUI/BoardLayout.h"
+#include <algorithm>
+#include <cmath>
+
+BoardLayout::BoardLayout()
+    : rows(0), cols(0), cardSize(80.0f), spacing(10.0f), origin(0.0f, 0.0f) {
+}
+
+void BoardLayout::configure(int newRows, int newCols, float newCardSize, float newSpacing,
+                            const sf::Vector2f& newOrigin) {
+    rows = newRows;
+    cols = newCols;
+    cardSize = newCardSize;
+    spacing = newSpacing;
+    origin = newOrigin;
+}
+
+sf::FloatRect BoardLayout::getBounds() const {
+    float step = cardSize + spacing;
+    return sf::FloatRect(origin.x, origin.y,
+                         cols * step - spacing, rows * step - spacing);
+}
+
+sf::Vector2f BoardLayout::getCardPosition(int index) const {
+    float step = cardSize + spacing;
+    int row = index / cols;
+    int col = index % cols;
+    return sf::Vector2f(origin.x + col * step, origin.y + row * step);
+}
+
+int BoardLayout::cardAt(const sf::Vector2f& point) const {
+    if (rows <= 0 || cols <= 0) return -1;
+    
+    float step = cardSize + spacing;
+    float localX = point.x - origin.x;
+    float localY = point.y - origin.y;
+    if (localX < 0 || localY < 0) return -1;
+    
+    int col = static_cast<int>(localX / step);
+    int row = static_cast<int>(localY / step);
+    if (col >= cols || row >= rows) return -1;
+    
+    // Клик в зазор между картами не считается
+    if (localX - col * step > cardSize || localY - row * step > cardSize) return -1;
+    
+    return row * cols + col;
+}
+
+BoardLayout::Range BoardLayout::getRange(const sf::FloatRect& area) const {
+    float step = cardSize + spacing;
+    
+    Range range;
+    range.firstCol = std::max(0, static_cast<int>(std::floor((area.left - origin.x) / step)));
+    range.firstRow = std::max(0, static_cast<int>(std::floor((area.top - origin.y) / step)));
+    range.endCol = std::min(cols, static_cast<int>(std::floor((area.left + area.width - origin.x) / step)) + 1);
+    range.endRow = std::min(rows, static_cast<int>(std::floor((area.top + area.height - origin.y) / step)) + 1);
+    return range;
+}
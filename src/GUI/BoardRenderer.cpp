@@ -0,0 +1,137 @@
+#include "GUI/BoardRenderer.h"
+#include "GUI/TextureAtlas.h"
+
+BoardRenderer::BoardRenderer()
+    : shapeVertices(sf::Triangles), imageVertices(sf::Triangles), visibleRange{0, 0, 0, 0}, valid(false) {
+}
+
+void BoardRenderer::writeQuad(sf::Vertex* quad, const sf::FloatRect& rect, const sf::Color& color) {
+    sf::Vector2f topLeft(rect.left, rect.top);
+    sf::Vector2f topRight(rect.left + rect.width, rect.top);
+    sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+    sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+    
+    quad[0].position = topLeft;
+    quad[1].position = topRight;
+    quad[2].position = bottomRight;
+    quad[3].position = topLeft;
+    quad[4].position = bottomRight;
+    quad[5].position = bottomLeft;
+    
+    for (int i = 0; i < 6; i++) {
+        quad[i].color = color;
+    }
+}
+
+void BoardRenderer::update(const std::vector<std::unique_ptr<CardSprite>>& cards,
+                           const BoardLayout& layout, const BoardLayout::Range& range) {
+    if (!valid || range != visibleRange) {
+        slotCards.clear();
+        for (int row = range.firstRow; row < range.endRow; row++) {
+            for (int col = range.firstCol; col < range.endCol; col++) {
+                int index = row * layout.getCols() + col;
+                if (index < static_cast<int>(cards.size())) {
+                    slotCards.push_back(index);
+                }
+            }
+        }
+        
+        shapeVertices.resize(slotCards.size() * SHAPE_VERTICES);
+        imageVertices.resize(slotCards.size() * IMAGE_VERTICES);
+        slotVersions.assign(slotCards.size(), 0);
+        
+        for (size_t slot = 0; slot < slotCards.size(); slot++) {
+            writeCard(slot, *cards[slotCards[slot]]);
+        }
+        
+        visibleRange = range;
+        valid = true;
+    } else {
+        for (size_t slot = 0; slot < slotCards.size(); slot++) {
+            const CardSprite& card = *cards[slotCards[slot]];
+            if (card.getVersion() != slotVersions[slot]) {
+                writeCard(slot, card);
+            }
+        }
+    }
+    
+    textCards.clear();
+    for (int index : slotCards) {
+        const CardSprite* card = cards[index].get();
+        if (!card->getHasImage() && card->getDisplayedState() != CardState::HIDDEN) {
+            textCards.push_back(card);
+        }
+    }
+}
+
+void BoardRenderer::writeCard(size_t slot, const CardSprite& card) {
+    slotVersions[slot] = card.getVersion();
+    
+    // Анимации масштабируют карту относительно ее центра и меняют прозрачность
+    const sf::RectangleShape& shape = card.getShape();
+    sf::Vector2f center = shape.getPosition() + shape.getSize() / 2.0f;
+    sf::Vector2f animScale = card.getAnimationScale();
+    sf::Uint8 alpha = card.getAnimationAlpha();
+    
+    auto scaled = [&](float left, float top, float width, float height) {
+        return sf::FloatRect(center.x + (left - center.x) * animScale.x,
+                             center.y + (top - center.y) * animScale.y,
+                             width * animScale.x, height * animScale.y);
+    };
+    auto faded = [alpha](sf::Color color) {
+        color.a = static_cast<sf::Uint8>(color.a * alpha / 255);
+        return color;
+    };
+    
+    // Рамка - прямоугольник, расширенный на толщину контура, поверх него фон
+    sf::Vector2f position = shape.getPosition();
+    sf::Vector2f size = shape.getSize();
+    float outline = shape.getOutlineThickness();
+    
+    sf::Vertex* shapeQuad = &shapeVertices[slot * SHAPE_VERTICES];
+    writeQuad(shapeQuad, scaled(position.x - outline, position.y - outline,
+                                size.x + outline * 2, size.y + outline * 2),
+              faded(shape.getOutlineColor()));
+    writeQuad(shapeQuad + 6, scaled(position.x, position.y, size.x, size.y),
+              faded(shape.getFillColor()));
+    
+    // Картинка видна только у открытых карт, у скрытых квад вырожденный
+    sf::Vertex* imageQuad = &imageVertices[slot * IMAGE_VERTICES];
+    if (card.getHasImage() && card.getDisplayedState() != CardState::HIDDEN) {
+        const sf::Sprite& sprite = card.getImageSprite();
+        sf::IntRect region = sprite.getTextureRect();
+        sf::Vector2f spriteScale = sprite.getScale();
+        sf::Vector2f origin = sprite.getOrigin();
+        sf::Vector2f spritePosition = sprite.getPosition();
+        
+        writeQuad(imageQuad, scaled(spritePosition.x - origin.x * spriteScale.x,
+                                    spritePosition.y - origin.y * spriteScale.y,
+                                    region.width * spriteScale.x, region.height * spriteScale.y),
+                  faded(sf::Color::White));
+        
+        float left = static_cast<float>(region.left);
+        float top = static_cast<float>(region.top);
+        float right = left + region.width;
+        float bottom = top + region.height;
+        
+        imageQuad[0].texCoords = sf::Vector2f(left, top);
+        imageQuad[1].texCoords = sf::Vector2f(right, top);
+        imageQuad[2].texCoords = sf::Vector2f(right, bottom);
+        imageQuad[3].texCoords = sf::Vector2f(left, top);
+        imageQuad[4].texCoords = sf::Vector2f(right, bottom);
+        imageQuad[5].texCoords = sf::Vector2f(left, bottom);
+    } else {
+        writeQuad(imageQuad, sf::FloatRect(0, 0, 0, 0), sf::Color::Transparent);
+    }
+}
+
+void BoardRenderer::render(sf::RenderTarget& target) const {
+    if (slotCards.empty()) return;
+    
+    target.draw(shapeVertices);
+    target.draw(imageVertices, &TextureAtlas::getInstance().getTexture());
+    
+    for (const CardSprite* card : textCards) {
+        card->renderSymbol(target);
+    }
+}
@@ -9,7 +9,10 @@ Button::Button(float x, float y, float width, float height,
       idleColor(sf::Color(70, 130, 180)),
       hoverColor(sf::Color(100, 149, 237)),
       activeColor(sf::Color(30, 144, 255)),
-      onClick(onClickFunc)
+      onClick(onClickFunc),
+      hovered(false),
+      pressed(false),
+      version(nextVersion())
 {
     shape.setPosition(x, y);
     shape.setSize(sf::Vector2f(width, height));
@@ -25,56 +28,97 @@ Button::Button(float x, float y, float width, float height,
     text.setCharacterSize(24);
     text.setFillColor(sf::Color::White);
     
+    layoutText();
+}
+
+unsigned int Button::nextVersion() {
+    // Общий счетчик: у новой кнопки на месте старой версия тоже будет другой
+    static unsigned int counter = 0;
+    return ++counter;
+}
+
+void Button::layoutText() {
     sf::FloatRect textBounds = text.getLocalBounds();
     text.setOrigin(textBounds.left + textBounds.width / 2.0f,
                    textBounds.top + textBounds.height / 2.0f);
-    text.setPosition(x + width / 2.0f, y + height / 2.0f);
+    
+    sf::Vector2f shapePos = shape.getPosition();
+    text.setPosition(shapePos.x + shape.getSize().x / 2.0f,
+                     shapePos.y + shape.getSize().y / 2.0f);
+    
+    // Тень готовим здесь, а не копируем текст каждый кадр
+    shadow = text;
+    shadow.setFillColor(sf::Color(0, 0, 0, 150));
+    shadow.move(2, 2);
+}
+
+bool Button::update(const sf::Vector2f& mousePos) {
+    bool nowHovered = shape.getGlobalBounds().contains(mousePos);
+    if (nowHovered == hovered) {
+        return false;
+    }
+    hovered = nowHovered;
+    
+    applyStateColors();
+    return true;
 }
 
-void Button::update(const sf::Vector2f& mousePos) {
-    if (shape.getGlobalBounds().contains(mousePos)) {
-        shape.setFillColor(hoverColor);
-        shape.setOutlineColor(sf::Color::Yellow);
+void Button::applyStateColors() {
+    if (pressed) {
+        shape.setFillColor(activeColor);
     } else {
-        shape.setFillColor(idleColor);
-        shape.setOutlineColor(sf::Color::White);
+        shape.setFillColor(hovered ? hoverColor : idleColor);
     }
+    shape.setOutlineColor(hovered ? sf::Color::Yellow : sf::Color::White);
 }
 
-void Button::render(sf::RenderWindow& window) {
-    window.draw(shape);
-    
+void Button::render(sf::RenderTarget& target) const {
+    target.draw(shape);
+    renderText(target);
+}
+
+void Button::renderIdle(sf::RenderTarget& target) const {
+    sf::RectangleShape idleShape = shape;
+    idleShape.setFillColor(idleColor);
+    idleShape.setOutlineColor(sf::Color::White);
+    target.draw(idleShape);
+    renderText(target);
+}
+
+void Button::renderText(sf::RenderTarget& target) const {
     if (fontPtr) {
-        sf::Text shadow = text;
-        shadow.setFillColor(sf::Color(0, 0, 0, 150));
-        shadow.move(2, 2);
-        window.draw(shadow);
+        target.draw(shadow);
     }
     
-    window.draw(text);
+    target.draw(text);
 }
 
 void Button::handleEvent(const sf::Event& event, const sf::Vector2f& mousePos) {
     if (event.type == sf::Event::MouseButtonPressed) {
         if (event.mouseButton.button == sf::Mouse::Left) {
             if (shape.getGlobalBounds().contains(mousePos)) {
-                shape.setFillColor(activeColor);
+                pressed = true;
+                applyStateColors();
                 if (onClick) {
                     onClick();
                 }
             }
         }
+    } else if (event.type == sf::Event::MouseButtonReleased) {
+        // Отпускание возвращает цвет наведения, даже если курсор не двигался
+        if (event.mouseButton.button == sf::Mouse::Left && pressed) {
+            pressed = false;
+            hovered = shape.getGlobalBounds().contains(mousePos);
+            applyStateColors();
+        }
     }
 }
 
 void Button::setPosition(float x, float y) {
     shape.setPosition(x, y);
+    version = nextVersion();
     
-    sf::FloatRect textBounds = text.getLocalBounds();
-    text.setOrigin(textBounds.left + textBounds.width / 2.0f,
-                   textBounds.top + textBounds.height / 2.0f);
-    text.setPosition(x + shape.getSize().x / 2.0f, 
-                     y + shape.getSize().y / 2.0f);
+    layoutText();
 }
 
 sf::Vector2f Button::getPosition() const {
@@ -85,22 +129,21 @@ void Button::setColors(const sf::Color& idle, const sf::Color& hover, const sf::
     idleColor = idle;
     hoverColor = hover;
     activeColor = active;
-    shape.setFillColor(idleColor);
+    applyStateColors();
+    version = nextVersion();
 }
 
 void Button::setText(const std::string& textStr) {
     text.setString(textStr);
+    version = nextVersion();
     
-    sf::FloatRect textBounds = text.getLocalBounds();
-    text.setOrigin(textBounds.left + textBounds.width / 2.0f,
-                   textBounds.top + textBounds.height / 2.0f);
-    
-    sf::Vector2f shapePos = shape.getPosition();
-    text.setPosition(shapePos.x + shape.getSize().x / 2.0f,
-                     shapePos.y + shape.getSize().y / 2.0f);
+    layoutText();
 }
 
 void Button::setFont(const sf::Font& font) {
     fontPtr = &font;
     text.setFont(font);
+    version = nextVersion();
+    
+    layoutText();
 }
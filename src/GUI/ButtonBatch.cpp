@@ -0,0 +1,168 @@
+#include "GUI/ButtonBatch.h"
+
+ButtonBatch::ButtonBatch()
+    : shapeVertices(sf::Triangles), glyphVertices(sf::Triangles), font(nullptr), characterSize(0),
+      cachedData(nullptr), cachedCount(0), cachedKey(0), valid(false) {
+}
+
+void ButtonBatch::writeQuad(sf::Vertex* quad, const sf::FloatRect& rect, const sf::Color& color) {
+    sf::Vector2f topLeft(rect.left, rect.top);
+    sf::Vector2f topRight(rect.left + rect.width, rect.top);
+    sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+    sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+    
+    quad[0].position = topLeft;
+    quad[1].position = topRight;
+    quad[2].position = bottomRight;
+    quad[3].position = topLeft;
+    quad[4].position = bottomRight;
+    quad[5].position = bottomLeft;
+    
+    for (int i = 0; i < 6; i++) {
+        quad[i].color = color;
+    }
+}
+
+unsigned long long ButtonBatch::computeKey(const std::vector<Button>& buttons) {
+    // Версия меняется при смене текста/позиции/цветов, цвет фигуры - при наведении и нажатии
+    unsigned long long key = buttons.size();
+    for (const auto& button : buttons) {
+        const sf::RectangleShape& shape = button.getShape();
+        key = key * 1000003ULL + button.getVersion();
+        key = key * 31ULL + shape.getFillColor().toInteger();
+        key = key * 31ULL + shape.getOutlineColor().toInteger();
+    }
+    return key;
+}
+
+void ButtonBatch::writeShape(sf::Vertex* vertices, const sf::RectangleShape& shape) const {
+    // Рамка RectangleShape лежит снаружи прямоугольника
+    sf::Vector2f position = shape.getPosition();
+    sf::Vector2f size = shape.getSize();
+    float thickness = shape.getOutlineThickness();
+    sf::Color outline = shape.getOutlineColor();
+    
+    writeQuad(vertices, sf::FloatRect(position.x - thickness, position.y - thickness,
+                                      size.x + thickness * 2, thickness), outline);
+    writeQuad(vertices + 6, sf::FloatRect(position.x - thickness, position.y + size.y,
+                                          size.x + thickness * 2, thickness), outline);
+    writeQuad(vertices + 12, sf::FloatRect(position.x - thickness, position.y,
+                                           thickness, size.y), outline);
+    writeQuad(vertices + 18, sf::FloatRect(position.x + size.x, position.y,
+                                           thickness, size.y), outline);
+    writeQuad(vertices + 24, sf::FloatRect(position.x, position.y, size.x, size.y), shape.getFillColor());
+}
+
+void ButtonBatch::appendText(const sf::Text& text, const sf::Color& color, const sf::Vector2f& offset) {
+    // Та же раскладка глифов, что строит sf::Text, но сразу в общий массив
+    const sf::String& string = text.getString();
+    bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+    float whitespaceWidth = font->getGlyph(L' ', characterSize, bold).advance;
+    float lineSpacing = font->getLineSpacing(characterSize);
+    
+    // Смещение тени задано в координатах экрана, как у shadow.move(2, 2)
+    sf::Transform transform;
+    transform.translate(offset);
+    transform *= text.getTransform();
+    
+    float x = 0.0f;
+    float y = static_cast<float>(characterSize);
+    sf::Uint32 previous = 0;
+    const float padding = 1.0f;
+    
+    for (std::size_t i = 0; i < string.getSize(); i++) {
+        sf::Uint32 current = string[i];
+        x += font->getKerning(previous, current, characterSize);
+        previous = current;
+        
+        if (current == ' ') { x += whitespaceWidth; continue; }
+        if (current == '\t') { x += whitespaceWidth * 4; continue; }
+        if (current == '\n') { y += lineSpacing; x = 0; continue; }
+        
+        const sf::Glyph& glyph = font->getGlyph(current, characterSize, bold);
+        
+        sf::FloatRect rect(x + glyph.bounds.left - padding, y + glyph.bounds.top - padding,
+                           glyph.bounds.width + padding * 2, glyph.bounds.height + padding * 2);
+        float u1 = glyph.textureRect.left - padding;
+        float v1 = glyph.textureRect.top - padding;
+        float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
+        float v2 = glyph.textureRect.top + glyph.textureRect.height + padding;
+        
+        size_t start = glyphVertices.getVertexCount();
+        glyphVertices.resize(start + 6);
+        sf::Vertex* quad = &glyphVertices[start];
+        writeQuad(quad, rect, color);
+        
+        quad[0].texCoords = sf::Vector2f(u1, v1);
+        quad[1].texCoords = sf::Vector2f(u2, v1);
+        quad[2].texCoords = sf::Vector2f(u2, v2);
+        quad[3].texCoords = sf::Vector2f(u1, v1);
+        quad[4].texCoords = sf::Vector2f(u2, v2);
+        quad[5].texCoords = sf::Vector2f(u1, v2);
+        
+        for (int v = 0; v < 6; v++) {
+            quad[v].position = transform.transformPoint(quad[v].position);
+        }
+        
+        x += glyph.advance;
+    }
+}
+
+void ButtonBatch::rebuild(const std::vector<Button>& buttons) {
+    fallbackButtons.clear();
+    glyphVertices.clear();
+    shapeVertices.resize(buttons.size() * SHAPE_VERTICES);
+    
+    // Подписи пакуются только для шрифта и размера первой кнопки - одна текстура глифов
+    font = nullptr;
+    for (const auto& button : buttons) {
+        if (button.getFont()) {
+            font = button.getFont();
+            characterSize = button.getText().getCharacterSize();
+            break;
+        }
+    }
+    
+    for (size_t i = 0; i < buttons.size(); i++) {
+        const Button& button = buttons[i];
+        writeShape(&shapeVertices[i * SHAPE_VERTICES], button.getShape());
+        
+        const sf::Text& text = button.getText();
+        if (!button.getFont()) continue;
+        
+        if (button.getFont() != font || text.getCharacterSize() != characterSize) {
+            fallbackButtons.push_back(&button);
+            continue;
+        }
+        
+        appendText(text, sf::Color(0, 0, 0, 150), sf::Vector2f(2, 2));
+        appendText(text, text.getFillColor(), sf::Vector2f(0, 0));
+    }
+}
+
+void ButtonBatch::render(sf::RenderTarget& target, const std::vector<Button>& buttons) {
+    if (buttons.empty()) return;
+    
+    unsigned long long key = computeKey(buttons);
+    if (!valid || cachedData != buttons.data() || cachedCount != buttons.size() || cachedKey != key) {
+        rebuild(buttons);
+        cachedData = buttons.data();
+        cachedCount = buttons.size();
+        cachedKey = key;
+        valid = true;
+    }
+    
+    target.draw(shapeVertices);
+    
+    if (font && glyphVertices.getVertexCount() > 0) {
+        // Текстура берется в момент отрисовки: страница глифов могла вырасти
+        sf::RenderStates states;
+        states.texture = &font->getTexture(characterSize);
+        target.draw(glyphVertices, states);
+    }
+    
+    // Подписи другим шрифтом рисуем обычным способом поверх своих фонов
+    for (const Button* button : fallbackButtons) {
+        button->renderText(target);
+    }
+}
@@ -1,10 +1,15 @@
 #include "GUI/CardSprite.h"
+#include "GUI/TextureAtlas.h"
+#include "GUI/SymbolAtlas.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 CardSprite::CardSprite(int id, const std::string& symbol, float x, float y, float size)
-    : id(id), symbol(symbol), state(CardState::HIDDEN), isClickable(true), hasImage(false) {
+    : id(id), symbol(symbol), state(CardState::HIDDEN), previousState(CardState::HIDDEN),
+      isClickable(true), hasImage(false), hasSymbolQuad(false), version(0),
+      flipProgress(1.0f), pulseProgress(1.0f), fadeProgress(1.0f) {
     
     shape.setPosition(x, y);
     shape.setSize(sf::Vector2f(size, size));
@@ -20,10 +25,15 @@ CardSprite::CardSprite(int id, const std::string& symbol, float x, float y, floa
 }
 
 bool CardSprite::loadImage(const std::string& imagePath) {
-    if (imageTexture.loadFromFile(imagePath)) {
+    TextureAtlas& atlas = TextureAtlas::getInstance();
+    sf::IntRect region;
+    
+    if (atlas.getRegion(imagePath, region)) {
         hasImage = true;
+        hasSymbolQuad = false;
         
-        imageSprite.setTexture(imageTexture);
+        imageSprite.setTexture(atlas.getTexture());
+        imageSprite.setTextureRect(region);
         
         sf::FloatRect imageBounds = imageSprite.getLocalBounds();
         float scaleX = (shape.getSize().x * 0.8f) / imageBounds.width;
@@ -32,6 +42,7 @@ bool CardSprite::loadImage(const std::string& imagePath) {
         
         imageSprite.setScale(scale, scale);
         centerImage();
+        version++;
         
         return true;
     }
@@ -57,6 +68,7 @@ void CardSprite::setSymbol(const std::string& symbol, const sf::Font& mainFont)
     }
     
     hasImage = false;
+    hasSymbolQuad = false;
     symbolText.setFont(mainFont);
     symbolText.setString(symbol);
     symbolText.setCharacterSize(static_cast<unsigned int>(shape.getSize().x * 0.4f));
@@ -64,6 +76,26 @@ void CardSprite::setSymbol(const std::string& symbol, const sf::Font& mainFont)
     symbolText.setStyle(sf::Text::Bold);
     
     centerText();
+    loadSymbolQuad();
+    version++;
+}
+
+bool CardSprite::loadSymbolQuad() {
+    // Символ растеризуется один раз в общий атлас и рисуется квадом в пачке с картинками
+    sf::IntRect region;
+    if (!symbolText.getFont() ||
+        !SymbolAtlas::getInstance().getRegion(symbol, *symbolText.getFont(),
+                                             symbolText.getCharacterSize(), region)) {
+        return false;
+    }
+    
+    hasImage = true;
+    hasSymbolQuad = true;
+    imageSprite.setTexture(TextureAtlas::getInstance().getTexture());
+    imageSprite.setTextureRect(region);
+    imageSprite.setScale(1.0f, 1.0f);
+    centerImage();
+    return true;
 }
 
 void CardSprite::setClickable(bool clickable) {
@@ -82,6 +114,18 @@ void CardSprite::centerText() {
             shape.getPosition().x + shape.getSize().x / 2.0f,
             shape.getPosition().y + shape.getSize().y / 2.0f
         );
+        
+        // Подложка и тень готовятся здесь, а не создаются каждый кадр в render
+        symbolShadow = symbolText;
+        symbolShadow.setFillColor(sf::Color(0, 0, 0, 100));
+        symbolShadow.move(2, 2);
+        
+        symbolBackground.setSize(sf::Vector2f(textBounds.width + 20, textBounds.height + 20));
+        symbolBackground.setFillColor(sf::Color(255, 255, 255, 100));
+        symbolBackground.setPosition(
+            symbolText.getPosition().x - symbolBackground.getSize().x / 2,
+            symbolText.getPosition().y - symbolBackground.getSize().y / 2
+        );
     }
 }
 
@@ -104,38 +148,95 @@ void CardSprite::setPosition(float x, float y) {
     shape.setPosition(x, y);
     centerText();
     centerImage();
+    version++;
 }
 
 void CardSprite::setSize(float size) {
     shape.setSize(sf::Vector2f(size, size));
     symbolText.setCharacterSize(static_cast<unsigned int>(size * 0.4f));
     centerText();
+    
+    // Растровый символ нарисован под старый размер шрифта
+    if (hasSymbolQuad && !loadSymbolQuad()) {
+        hasImage = false;
+        hasSymbolQuad = false;
+    }
+    
     centerImage();
+    version++;
 }
 
 void CardSprite::setState(CardState newState) {
+    previousState = state;
     state = newState;
+    version++;
     
-    switch (state) {
+    isClickable = (state == CardState::HIDDEN);
+    applyAppearance();
+}
+
+void CardSprite::applyAppearance() {
+    // Цвета берутся от видимого состояния, чтобы лицо менялось в середине переворота
+    switch (getDisplayedState()) {
         case CardState::HIDDEN:
             shape.setFillColor(sf::Color(25, 25, 112));
             shape.setOutlineColor(sf::Color::White);
-            isClickable = true;
+            shape.setOutlineThickness(2);
             break;
         case CardState::REVEALED:
             shape.setFillColor(sf::Color(100, 149, 237));
             shape.setOutlineColor(sf::Color::Yellow);
-            isClickable = false;
+            shape.setOutlineThickness(2);
             break;
         case CardState::MATCHED:
             shape.setFillColor(sf::Color(50, 205, 50));
             shape.setOutlineColor(sf::Color::Green);
             shape.setOutlineThickness(3);
-            isClickable = false;
             break;
     }
 }
 
+CardState CardSprite::getDisplayedState() const {
+    return flipProgress < 0.5f ? previousState : state;
+}
+
+void CardSprite::setFlipProgress(float progress) {
+    bool crossedMiddle = (flipProgress < 0.5f) != (progress < 0.5f);
+    flipProgress = progress;
+    version++;
+    
+    if (crossedMiddle) {
+        applyAppearance();
+    }
+}
+
+void CardSprite::setPulseProgress(float progress) {
+    pulseProgress = progress;
+    version++;
+}
+
+void CardSprite::setFadeProgress(float progress) {
+    fadeProgress = progress;
+    version++;
+}
+
+sf::Vector2f CardSprite::getAnimationScale() const {
+    // Переворот: ширина сжимается до нуля к середине и возвращается обратно
+    float flip = std::abs(1.0f - 2.0f * flipProgress);
+    
+    // Пульсация: плавный подъем до +15% и возврат
+    float pulse = 1.0f;
+    if (pulseProgress < 1.0f) {
+        pulse += 0.15f * std::sin(pulseProgress * 3.14159265f);
+    }
+    
+    return sf::Vector2f(flip * pulse, pulse);
+}
+
+sf::Uint8 CardSprite::getAnimationAlpha() const {
+    return static_cast<sf::Uint8>(255.0f * std::max(0.0f, std::min(1.0f, fadeProgress)));
+}
+
 void CardSprite::flip() {
     if (state == CardState::HIDDEN) {
         setState(CardState::REVEALED);
@@ -160,37 +261,33 @@ bool CardSprite::contains(const sf::Vector2f& point) const {
     return shape.getGlobalBounds().contains(point) && isClickable;
 }
 
-void CardSprite::update(float deltaTime) {
-    (void)deltaTime;
-}
-
 void CardSprite::render(sf::RenderWindow& window) {
     window.draw(shape);
     
-    if (state != CardState::HIDDEN) {
+    if (getDisplayedState() != CardState::HIDDEN) {
         if (hasImage) {
             window.draw(imageSprite);
-        } else if (symbolText.getFont()) {
-            sf::FloatRect textBounds = symbolText.getLocalBounds();
-            if (textBounds.width > 0 && textBounds.height > 0) {
-                sf::RectangleShape textBackground(sf::Vector2f(
-                    textBounds.width + 20,
-                    textBounds.height + 20
-                ));
-                textBackground.setFillColor(sf::Color(255, 255, 255, 100));
-                textBackground.setPosition(
-                    symbolText.getPosition().x - textBackground.getSize().x / 2,
-                    symbolText.getPosition().y - textBackground.getSize().y / 2
-                );
-                window.draw(textBackground);
-                
-                sf::Text shadow = symbolText;
-                shadow.setFillColor(sf::Color(0, 0, 0, 100));
-                shadow.move(2, 2);
-                window.draw(shadow);
-            }
-            
-            window.draw(symbolText);
+        } else {
+            renderSymbol(window);
         }
     }
 }
+
+void CardSprite::renderSymbol(sf::RenderTarget& target) const {
+    if (!symbolText.getFont()) return;
+    
+    // Символ сжимается вместе с картой при перевороте
+    sf::Vector2f scale = getAnimationScale();
+    sf::RenderStates states;
+    states.transform.scale(scale.x, scale.y,
+                           shape.getPosition().x + shape.getSize().x / 2.0f,
+                           shape.getPosition().y + shape.getSize().y / 2.0f);
+    
+    sf::FloatRect textBounds = symbolText.getLocalBounds();
+    if (textBounds.width > 0 && textBounds.height > 0) {
+        target.draw(symbolBackground, states);
+        target.draw(symbolShadow, states);
+    }
+    
+    target.draw(symbolText, states);
+}
@@ -0,0 +1,26 @@
+#include "GUI/DrawableCache.h"
+
+void DrawableCache::beginRebuild() {
+    drawables.clear();
+    valid = true;
+}
+
+sf::Text& DrawableCache::addText(const std::string& str, const sf::Font& font, unsigned int size) {
+    auto text = std::make_unique<sf::Text>(str, font, size);
+    sf::Text& ref = *text;
+    drawables.push_back(std::move(text));
+    return ref;
+}
+
+sf::RectangleShape& DrawableCache::addRect(const sf::Vector2f& size) {
+    auto rect = std::make_unique<sf::RectangleShape>(size);
+    sf::RectangleShape& ref = *rect;
+    drawables.push_back(std::move(rect));
+    return ref;
+}
+
+void DrawableCache::render(sf::RenderTarget& target) const {
+    for (const auto& drawable : drawables) {
+        target.draw(*drawable);
+    }
+}
@@ -0,0 +1,103 @@
+#include "GUI/FontManager.h"
+#include "AssetPack.h"
+#include "Logger.h"
+#include <algorithm>
+
+FontManager& FontManager::getInstance() {
+    static FontManager instance;
+    return instance;
+}
+
+sf::Font& FontManager::getFont(const std::string& name) {
+    Slot& slot = slots[name];
+    if (!slot.font) {
+        slot.font = std::make_unique<sf::Font>();
+    }
+    return *slot.font;
+}
+
+bool FontManager::load(const std::string& name, const std::vector<std::string>& paths) {
+    if (isLoaded(name)) return true;
+    
+    sf::Font& font = getFont(name);
+    const AssetPack& pack = AssetPack::getInstance();
+    
+    // Сначала пути из архива - их проверка не трогает диск
+    for (int pass = 0; pass < 2; pass++) {
+        for (const auto& path : paths) {
+            const AssetPack::Entry* entry = pack.find(path);
+            if ((pass == 0) != (entry != nullptr)) continue;
+            
+            // Данные архива отображены до выхода, loadFromMemory их не копирует
+            bool loaded = entry ? font.loadFromMemory(entry->data, entry->size)
+                                : font.loadFromFile(path);
+            if (loaded) {
+                slots[name].path = path;
+                LOG_DEBUG("assets", "Шрифт " << name << ": " << path);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool FontManager::isLoaded(const std::string& name) const {
+    auto it = slots.find(name);
+    return it != slots.end() && !it->second.path.empty();
+}
+
+const std::string& FontManager::getPath(const std::string& name) const {
+    static const std::string empty;
+    auto it = slots.find(name);
+    return it != slots.end() ? it->second.path : empty;
+}
+
+const std::vector<sf::Uint32>& FontManager::getWarmUpCharacters() {
+    static const std::vector<sf::Uint32> characters = []() {
+        std::vector<sf::Uint32> result;
+        for (sf::Uint32 c = 0x20; c <= 0x7E; c++) result.push_back(c);
+        // Кириллица: А-я, Ё, ё
+        for (sf::Uint32 c = 0x410; c <= 0x44F; c++) result.push_back(c);
+        result.push_back(0x401);
+        result.push_back(0x451);
+        return result;
+    }();
+    return characters;
+}
+
+void FontManager::warmUp(const sf::Font& font, unsigned int characterSize, bool bold, float outline) {
+    for (sf::Uint32 c : getWarmUpCharacters()) {
+        font.getGlyph(c, characterSize, bold, outline);
+    }
+}
+
+void FontManager::queueWarmUp(const sf::Font& font, unsigned int characterSize, bool bold, float outline) {
+    pending.push_back(WarmUpJob{&font, characterSize, bold, outline, 0});
+}
+
+bool FontManager::warmUpPending(sf::Time budget) {
+    const std::vector<sf::Uint32>& characters = getWarmUpCharacters();
+    sf::Clock clock;
+    
+    while (!pending.empty()) {
+        WarmUpJob& job = pending.front();
+        
+        // Время проверяем пачками: одна растеризация занимает микросекунды
+        size_t end = std::min(job.next + 16, characters.size());
+        for (; job.next < end; job.next++) {
+            job.font->getGlyph(characters[job.next], job.characterSize, job.bold, job.outline);
+        }
+        
+        if (job.next >= characters.size()) {
+            pending.pop_front();
+        }
+        if (clock.getElapsedTime() >= budget) break;
+    }
+    
+    return pending.empty();
+}
+
+void FontManager::clear() {
+    pending.clear();
+    slots.clear();
+}
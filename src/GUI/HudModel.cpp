@@ -0,0 +1,41 @@
+#include "GUI/HudModel.h"
+#include <cstdio>
+
+HudModel::HudModel()
+    : timerSeconds(-1), moves(-1), matchedPairs(-1), totalPairs(-1), score(-1), valid(false) {
+}
+
+bool HudModel::setTimer(int seconds) {
+    if (valid && seconds == timerSeconds) return false;
+    
+    timerSeconds = seconds;
+    return true;
+}
+
+bool HudModel::setProgress(int newMoves, int newMatchedPairs, int newTotalPairs) {
+    if (valid && newMoves == moves && newMatchedPairs == matchedPairs && newTotalPairs == totalPairs) {
+        return false;
+    }
+    
+    moves = newMoves;
+    matchedPairs = newMatchedPairs;
+    totalPairs = newTotalPairs;
+    return true;
+}
+
+bool HudModel::setScore(int newScore) {
+    if (valid && newScore == score) return false;
+    
+    score = newScore;
+    return true;
+}
+
+std::string HudModel::formatTimer() const {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "Time: %02d:%02d", timerSeconds / 60, timerSeconds % 60);
+    return buffer;
+}
+
+std::string HudModel::formatScore() const {
+    return "Score: " + std::to_string(score);
+}
@@ -0,0 +1,150 @@
+#include "GUI/ImagePrefetcher.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+
+ImagePrefetcher::ImagePrefetcher()
+    : cacheSettings("cache/thumbnails"), maxSide(0), stopRequested(false) {
+}
+
+ImagePrefetcher::~ImagePrefetcher() {
+    stop();
+}
+
+void ImagePrefetcher::configure(const ThumbnailCache& cache, unsigned int side) {
+    std::lock_guard<std::mutex> lock(mutex);
+    cacheSettings = cache;
+    maxSide = side;
+}
+
+void ImagePrefetcher::startWorkers() {
+    // MEMORY_GAME_PREFETCH_THREADS=<n> задает размер пула, =0 отключает предзагрузку
+    unsigned int hardware = std::thread::hardware_concurrency();
+    unsigned int count = std::clamp(hardware > 1 ? hardware - 1 : 1u, 1u, 4u);
+    
+    const char* threadsEnv = std::getenv("MEMORY_GAME_PREFETCH_THREADS");
+    if (threadsEnv) {
+        count = static_cast<unsigned int>(std::max(0, std::atoi(threadsEnv)));
+    }
+    
+    stopRequested = false;
+    for (unsigned int i = 0; i < count; i++) {
+        workers.emplace_back(&ImagePrefetcher::workerLoop, this);
+    }
+    
+    LOG_DEBUG("assets", "Предзагрузка картинок: потоков " << count);
+}
+
+void ImagePrefetcher::request(const std::vector<std::string>& paths) {
+    size_t added = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (workers.empty()) {
+            startWorkers();
+            if (workers.empty()) return;
+        }
+        
+        // Не начатые задачи и готовые картинки прошлого выбора больше не нужны
+        queue.clear();
+        queued.clear();
+        
+        requested = std::unordered_set<std::string>(paths.begin(), paths.end());
+        for (auto it = ready.begin(); it != ready.end(); ) {
+            it = requested.count(it->first) ? std::next(it) : ready.erase(it);
+        }
+        
+        // Неудачи не запоминаются: файл мог дописываться, при новом выборе пробуем снова
+        for (const auto& path : paths) {
+            if (ready.count(path) || inProgress.count(path) || queued.count(path)) {
+                continue;
+            }
+            queue.push_back(path);
+            queued.insert(path);
+            added++;
+        }
+    }
+    
+    if (added > 0) {
+        wakeUp.notify_all();
+        LOG_DEBUG("assets", "Предзагрузка картинок: в очереди " << added);
+    }
+}
+
+bool ImagePrefetcher::take(const std::string& path, sf::Image& image) {
+    std::unique_lock<std::mutex> lock(mutex);
+    
+    if (queued.erase(path)) {
+        // Еще не начато - главный поток декодирует сам, чем ждать очереди
+        queue.erase(std::find(queue.begin(), queue.end(), path));
+        return false;
+    }
+    
+    finished.wait(lock, [this, &path]() { return !inProgress.count(path); });
+    
+    auto it = ready.find(path);
+    if (it == ready.end()) {
+        return false;
+    }
+    
+    image = std::move(it->second);
+    ready.erase(it);
+    return true;
+}
+
+void ImagePrefetcher::forget(const std::string& path) {
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this, &path]() { return !inProgress.count(path); });
+    ready.erase(path);
+}
+
+void ImagePrefetcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+        queue.clear();
+        queued.clear();
+    }
+    wakeUp.notify_all();
+    
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    inProgress.clear();
+    ready.clear();
+    requested.clear();
+}
+
+void ImagePrefetcher::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    ThumbnailCache cache = cacheSettings;
+    
+    while (true) {
+        wakeUp.wait(lock, [this]() { return stopRequested || !queue.empty(); });
+        if (stopRequested) break;
+        
+        std::string path = std::move(queue.front());
+        queue.pop_front();
+        queued.erase(path);
+        inProgress.insert(path);
+        unsigned int side = maxSide;
+        
+        // Декодирование и уменьшение идут без блокировки
+        lock.unlock();
+        sf::Image image;
+        bool ok = cache.load(path, side, image);
+        lock.lock();
+        
+        inProgress.erase(path);
+        // Пока декодировали, выбор мог смениться - ненужную картинку не храним
+        if (ok && requested.count(path)) {
+            ready[path] = std::move(image);
+        }
+        finished.notify_all();
+    }
+}
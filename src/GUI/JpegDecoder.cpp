@@ -0,0 +1,181 @@
+#include "GUI/JpegDecoder.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <vector>
+
+#ifdef MEMORY_GAME_HAVE_JPEG
+#include <csetjmp>
+#include <jpeglib.h>
+#include <jerror.h>
+
+namespace {
+    // Стандартный обработчик libjpeg завершает процесс - возвращаемся через longjmp
+    struct ErrorManager {
+        jpeg_error_mgr base;
+        std::jmp_buf jump;
+        bool corrupt = false;  // Прервались из-за поврежденных данных, а не неподдержки
+    };
+    
+    void onError(j_common_ptr info) {
+        ErrorManager* errors = reinterpret_cast<ErrorManager*>(info->err);
+        char message[JMSG_LENGTH_MAX];
+        (*info->err->format_message)(info, message);
+        LOG_DEBUG("assets", "libjpeg: " << message);
+        std::longjmp(errors->jump, 1);
+    }
+    
+    void onWarning(j_common_ptr info, int level) {
+        // level < 0 - предупреждение; стандартный emit_message считает их сам
+        if (level >= 0) return;
+        info->err->num_warnings++;
+        
+        // Оборванный или поврежденный поток libjpeg дополняет серым и сообщает
+        // только предупреждением - такую картинку считаем испорченной и прерываемся сразу.
+        // Лишние байты между маркерами (частые у камер и редакторов) картинке не мешают
+        switch (info->err->msg_code) {
+            case JWRN_JPEG_EOF:
+            case JWRN_MUST_RESYNC:
+            case JWRN_HUFF_BAD_CODE:
+            case JWRN_NOT_SEQUENTIAL:
+                reinterpret_cast<ErrorManager*>(info->err)->corrupt = true;
+                onError(info);
+                break;
+            default:
+                break;
+        }
+    }
+    
+    // Наибольшее уменьшение (8/8 .. 1/8), при котором картинка еще не меньше minSide
+    void chooseScale(jpeg_decompress_struct& info, unsigned int minSide) {
+        info.scale_num = 1;
+        for (unsigned int denom : {8u, 4u, 2u, 1u}) {
+            info.scale_denom = denom;
+            jpeg_calc_output_dimensions(&info);
+            if (std::max(info.output_width, info.output_height) >= minSide) return;
+        }
+    }
+    
+    // Буферы принадлежат вызывающему: longjmp из обработчика ошибок не должен
+    // перепрыгивать через деструкторы
+    void decompress(jpeg_decompress_struct& info, unsigned int minSide, sf::Image& image,
+                    std::vector<sf::Uint8>& pixels, std::vector<JSAMPLE>& row) {
+        jpeg_read_header(&info, TRUE);
+        
+        chooseScale(info, minSide);
+#ifdef JCS_EXTENSIONS
+        // libjpeg-turbo: преобразование YCbCr -> RGBA в SIMD без отдельного прохода
+        info.out_color_space = JCS_EXT_RGBA;
+#else
+        info.out_color_space = JCS_RGB;
+#endif
+        jpeg_start_decompress(&info);
+        
+        unsigned int width = info.output_width;
+        unsigned int height = info.output_height;
+        unsigned int components = static_cast<unsigned int>(info.output_components);
+        
+        pixels.resize(static_cast<size_t>(width) * height * 4);
+        row.resize(components == 4 ? 0 : static_cast<size_t>(width) * components);
+        
+        while (info.output_scanline < height) {
+            sf::Uint8* target = &pixels[static_cast<size_t>(info.output_scanline) * width * 4];
+            if (components == 4) {
+                JSAMPROW rows[1] = {target};
+                jpeg_read_scanlines(&info, rows, 1);
+                continue;
+            }
+            
+            JSAMPROW rows[1] = {row.data()};
+            jpeg_read_scanlines(&info, rows, 1);
+            for (unsigned int x = 0; x < width; x++) {
+                const JSAMPLE* source = &row[static_cast<size_t>(x) * components];
+                target[x * 4 + 0] = source[0];
+                target[x * 4 + 1] = source[components == 1 ? 0 : 1];
+                target[x * 4 + 2] = source[components == 1 ? 0 : 2];
+                target[x * 4 + 3] = 255;
+            }
+        }
+        
+        jpeg_finish_decompress(&info);
+        image.create(width, height, pixels.data());
+    }
+}
+#endif
+
+bool JpegDecoder::isJpeg(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    return size >= 3 && bytes[0] == 0xFF && bytes[1] == 0xD8 && bytes[2] == 0xFF;
+}
+
+bool JpegDecoder::isJpegPath(const std::string& path) {
+    std::string ext = path.substr(std::min(path.size(), path.rfind('.')));
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".jpg" || ext == ".jpeg";
+}
+
+JpegDecoder::Result JpegDecoder::decode(const void* data, std::size_t size, unsigned int minSide, sf::Image& image) {
+#ifdef MEMORY_GAME_HAVE_JPEG
+    if (!isJpeg(data, size)) return Result::UNSUPPORTED;
+    
+    jpeg_decompress_struct info;
+    ErrorManager errors;
+    std::vector<sf::Uint8> pixels;
+    std::vector<JSAMPLE> row;
+    info.err = jpeg_std_error(&errors.base);
+    errors.base.error_exit = onError;
+    errors.base.emit_message = onWarning;
+    
+    if (setjmp(errors.jump)) {
+        jpeg_destroy_decompress(&info);
+        return errors.corrupt ? Result::CORRUPT : Result::UNSUPPORTED;
+    }
+    
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, static_cast<const unsigned char*>(data), static_cast<unsigned long>(size));
+    decompress(info, minSide, image, pixels, row);
+    jpeg_destroy_decompress(&info);
+    return Result::DECODED;
+#else
+    (void)data;
+    (void)size;
+    (void)minSide;
+    (void)image;
+    return Result::UNSUPPORTED;
+#endif
+}
+
+JpegDecoder::Result JpegDecoder::decodeFile(const std::string& path, unsigned int minSide, sf::Image& image) {
+#ifdef MEMORY_GAME_HAVE_JPEG
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return Result::UNSUPPORTED;
+    
+    jpeg_decompress_struct info;
+    ErrorManager errors;
+    std::vector<sf::Uint8> pixels;
+    std::vector<JSAMPLE> row;
+    info.err = jpeg_std_error(&errors.base);
+    errors.base.error_exit = onError;
+    errors.base.emit_message = onWarning;
+    
+    if (setjmp(errors.jump)) {
+        jpeg_destroy_decompress(&info);
+        std::fclose(file);
+        return errors.corrupt ? Result::CORRUPT : Result::UNSUPPORTED;
+    }
+    
+    // Читаем файл потоком: сжатые данные тоже не держим в памяти целиком
+    jpeg_create_decompress(&info);
+    jpeg_stdio_src(&info, file);
+    decompress(info, minSide, image, pixels, row);
+    jpeg_destroy_decompress(&info);
+    std::fclose(file);
+    return Result::DECODED;
+#else
+    (void)path;
+    (void)minSide;
+    (void)image;
+    return Result::UNSUPPORTED;
+#endif
+}
@@ -92,9 +92,7 @@ void Menu::render(sf::RenderWindow& window) {
     window.draw(background);
     window.draw(title);
     
-    for (auto& button : buttons) {
-        button.render(window);
-    }
+    buttonBatch.render(window, buttons);
 }
 
 void Menu::setBackgroundColor(const sf::Color& color) {
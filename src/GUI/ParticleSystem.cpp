@@ -0,0 +1,214 @@
+#include "GUI/ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const float MIN_QUALITY = 0.2f;
+    const float SPARK_GRAVITY = 120.0f;
+    const float CONFETTI_GRAVITY = 260.0f;
+    
+    const sf::Color CONFETTI_COLORS[] = {
+        sf::Color(255, 215, 0),
+        sf::Color(255, 90, 90),
+        sf::Color(90, 200, 255),
+        sf::Color(120, 230, 120),
+        sf::Color(230, 120, 255)
+    };
+}
+
+ParticleSystem::ParticleSystem(size_t capacity)
+    : capacity(capacity), count(0), vertices(sf::Triangles), verticesDirty(false),
+      quality(1.0f), averageWork(0.0f),
+      confettiTimeLeft(0.0f), confettiRate(0.0f), confettiCarry(0.0f),
+      rngState(0x9E3779B9u) {
+    
+    // Память выделяется один раз, дальше частицы только перезаписываются
+    posX.resize(capacity);
+    posY.resize(capacity);
+    velX.resize(capacity);
+    velY.resize(capacity);
+    life.resize(capacity);
+    invMaxLife.resize(capacity);
+    sizes.resize(capacity);
+    gravity.resize(capacity);
+    colors.resize(capacity);
+}
+
+float ParticleSystem::random01() {
+    // xorshift32 - детерминированный и дешевый, качества хватает для эффектов
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (rngState >> 8) * (1.0f / 16777216.0f);
+}
+
+size_t ParticleSystem::getBudget() const {
+    return static_cast<size_t>(capacity * quality);
+}
+
+void ParticleSystem::setQuality(float value) {
+    quality = std::max(MIN_QUALITY, std::min(value, 1.0f));
+}
+
+void ParticleSystem::adaptQuality(float frameWorkSeconds, float targetFrameSeconds) {
+    if (targetFrameSeconds <= 0.0f) return;
+    
+    averageWork = averageWork * 0.9f + frameWorkSeconds * 0.1f;
+    float load = averageWork / targetFrameSeconds;
+    
+    // Быстро уступаем время кадра и медленно возвращаем качество, чтобы не раскачиваться
+    if (load > 0.85f) {
+        setQuality(quality - 0.05f);
+    } else if (load < 0.5f) {
+        setQuality(quality + 0.01f);
+    }
+}
+
+void ParticleSystem::spawn(float x, float y, float vx, float vy, float lifeTime, float size,
+                           float fall, const sf::Color& color) {
+    if (count >= getBudget()) return;
+    
+    size_t i = count++;
+    posX[i] = x;
+    posY[i] = y;
+    velX[i] = vx;
+    velY[i] = vy;
+    life[i] = lifeTime;
+    invMaxLife[i] = 1.0f / lifeTime;
+    sizes[i] = size;
+    gravity[i] = fall;
+    colors[i] = color;
+}
+
+void ParticleSystem::burst(const sf::Vector2f& center, const sf::Color& color, size_t amount, float speed) {
+    size_t scaled = std::max<size_t>(1, static_cast<size_t>(amount * quality));
+    
+    for (size_t n = 0; n < scaled && count < getBudget(); n++) {
+        float angle = random01() * 6.2831853f;
+        float velocity = speed * (0.4f + 0.6f * random01());
+        spawn(center.x, center.y,
+              std::cos(angle) * velocity, std::sin(angle) * velocity,
+              0.5f + 0.4f * random01(), 3.0f + 3.0f * random01(), SPARK_GRAVITY, color);
+    }
+    
+    verticesDirty = true;
+}
+
+void ParticleSystem::startConfetti(const sf::FloatRect& area, float duration, float ratePerSecond) {
+    confettiArea = area;
+    confettiTimeLeft = duration;
+    confettiRate = ratePerSecond;
+    confettiCarry = 0.0f;
+}
+
+void ParticleSystem::stopEmitting() {
+    confettiTimeLeft = 0.0f;
+}
+
+void ParticleSystem::update(float deltaTime) {
+    if (!isActive()) return;
+    
+    // Новые конфетти: частота масштабируется качеством, остаток переносится в следующий кадр
+    if (confettiTimeLeft > 0.0f) {
+        confettiTimeLeft -= deltaTime;
+        confettiCarry += confettiRate * quality * deltaTime;
+        
+        const size_t colorCount = sizeof(CONFETTI_COLORS) / sizeof(CONFETTI_COLORS[0]);
+        while (confettiCarry >= 1.0f && count < getBudget()) {
+            confettiCarry -= 1.0f;
+            float x = confettiArea.left + random01() * confettiArea.width;
+            const sf::Color& color = CONFETTI_COLORS[static_cast<size_t>(random01() * colorCount) % colorCount];
+            spawn(x, confettiArea.top - 10.0f,
+                  (random01() - 0.5f) * 120.0f, 40.0f + random01() * 80.0f,
+                  2.0f + random01() * 1.5f, 4.0f + 4.0f * random01(), CONFETTI_GRAVITY, color);
+        }
+        confettiCarry = std::min(confettiCarry, 1.0f);
+    }
+    
+    // Интегрирование - плоские циклы по массивам без ветвлений (векторизуются)
+    const size_t n = count;
+    float* px = posX.data();
+    float* py = posY.data();
+    float* vx = velX.data();
+    float* vy = velY.data();
+    float* lf = life.data();
+    const float* g = gravity.data();
+    const float drag = 1.0f - std::min(deltaTime * 1.5f, 1.0f);
+    
+    for (size_t i = 0; i < n; i++) {
+        vy[i] += g[i] * deltaTime;
+        vx[i] *= drag;
+    }
+    for (size_t i = 0; i < n; i++) {
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+        lf[i] -= deltaTime;
+    }
+    
+    // Умершие частицы заменяем последними живыми - порядок для эффекта не важен
+    for (size_t i = count; i-- > 0;) {
+        if (life[i] > 0.0f) continue;
+        
+        size_t last = --count;
+        if (i != last) {
+            posX[i] = posX[last];
+            posY[i] = posY[last];
+            velX[i] = velX[last];
+            velY[i] = velY[last];
+            life[i] = life[last];
+            invMaxLife[i] = invMaxLife[last];
+            sizes[i] = sizes[last];
+            gravity[i] = gravity[last];
+            colors[i] = colors[last];
+        }
+    }
+    
+    verticesDirty = true;
+}
+
+void ParticleSystem::rebuildVertices() {
+    vertices.resize(count * 6);
+    
+    for (size_t i = 0; i < count; i++) {
+        float half = sizes[i] * 0.5f;
+        float left = posX[i] - half;
+        float top = posY[i] - half;
+        float right = posX[i] + half;
+        float bottom = posY[i] + half;
+        
+        // Угасание к концу жизни через альфу цвета вершин
+        sf::Color color = colors[i];
+        float fade = std::min(life[i] * invMaxLife[i] * 2.0f, 1.0f);
+        color.a = static_cast<sf::Uint8>(color.a * fade);
+        
+        sf::Vertex* quad = &vertices[i * 6];
+        quad[0].position = sf::Vector2f(left, top);
+        quad[1].position = sf::Vector2f(right, top);
+        quad[2].position = sf::Vector2f(right, bottom);
+        quad[3].position = sf::Vector2f(left, top);
+        quad[4].position = sf::Vector2f(right, bottom);
+        quad[5].position = sf::Vector2f(left, bottom);
+        for (int v = 0; v < 6; v++) {
+            quad[v].color = color;
+        }
+    }
+    
+    verticesDirty = false;
+}
+
+void ParticleSystem::render(sf::RenderTarget& target) {
+    if (count == 0) return;
+    
+    if (verticesDirty) {
+        rebuildVertices();
+    }
+    target.draw(vertices);
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+    confettiTimeLeft = 0.0f;
+    confettiCarry = 0.0f;
+    vertices.clear();
+    verticesDirty = false;
+}
@@ -0,0 +1,39 @@
+#include "GUI/ScreenLayer.h"
+
+ScreenLayer::ScreenLayer() : valid(false), contentKey(0) {
+}
+
+bool ScreenLayer::needsRebuild(unsigned long long key, const sf::Vector2u& size) const {
+    return !valid || key != contentKey || texture.getSize() != size;
+}
+
+sf::RenderTarget* ScreenLayer::begin(unsigned long long key, const sf::Vector2u& size, const sf::View& view) {
+    valid = false;
+    
+    if (texture.getSize() != size && !texture.create(size.x, size.y)) {
+        return nullptr;
+    }
+    
+    contentKey = key;
+    texture.setView(view);
+    texture.clear(sf::Color::Transparent);
+    return &texture;
+}
+
+void ScreenLayer::end() {
+    texture.display();
+    sprite.setTexture(texture.getTexture(), true);
+    valid = true;
+}
+
+void ScreenLayer::render(sf::RenderTarget& target) const {
+    // Слой совпадает с областью вывода текущего вида пиксель в пиксель,
+    // поэтому выводим его в пиксельном виде в ту же область
+    sf::View previousView = target.getView();
+    sf::Vector2u size = texture.getSize();
+    sf::View layerView(sf::FloatRect(0, 0, static_cast<float>(size.x), static_cast<float>(size.y)));
+    layerView.setViewport(previousView.getViewport());
+    target.setView(layerView);
+    target.draw(sprite);
+    target.setView(previousView);
+}
@@ -0,0 +1,376 @@
+#include "GUI/Screens.h"
+#include <iomanip>
+#include <sstream>
+
+void Screens::setupLoginButtons(std::vector<Button>& buttons, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                std::function<void()> onLogin, std::function<void()> onRegister,
+                                std::function<void()> onGuest) {
+    buttons.clear();
+    
+    float centerX = canvasSize.x / 2 - 150;
+    float startY = 450.0f;
+    float spacing = 70.0f;
+    
+    buttons.emplace_back(centerX, startY, 300.0f, 60.0f, "Login", font, std::move(onLogin));
+    buttons.emplace_back(centerX, startY + spacing, 300.0f, 60.0f, "Register", font, std::move(onRegister));
+    buttons.emplace_back(centerX, startY + spacing * 2, 300.0f, 60.0f, "Play as Guest", font, std::move(onGuest));
+    
+    // Настройка цвета кнопок
+    buttons[0].setColors(sf::Color(0, 150, 0), sf::Color(0, 200, 0), sf::Color(0, 100, 0));
+    buttons[1].setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
+    buttons[2].setColors(sf::Color(128, 128, 128), sf::Color(160, 160, 160), sf::Color(96, 96, 96));
+}
+
+void Screens::setupLoginErrorText(sf::Text& errorText, const sf::Font& font, const sf::Vector2u& canvasSize) {
+    errorText.setFont(font);
+    errorText.setCharacterSize(20);
+    errorText.setFillColor(sf::Color::Red);
+    errorText.setPosition(canvasSize.x / 2 - 150, 450.0f + 70.0f * 3);
+}
+
+void Screens::drawLogin(sf::RenderTarget& target, const sf::Font& font, const sf::Vector2u& canvasSize,
+                        const LoginView& view, const std::vector<Button>& buttons, ButtonBatch& batch,
+                        const sf::Text& errorText) {
+    // Заголовок
+    sf::Text title("Memory Game", font, 72);
+    title.setFillColor(sf::Color::White);
+    title.setStyle(sf::Text::Bold);
+    title.setPosition(canvasSize.x / 2 - 150, 50);
+    target.draw(title);
+    
+    sf::Text subtitle("Login to your account", font, 36);
+    subtitle.setFillColor(sf::Color(200, 200, 200));
+    subtitle.setPosition(canvasSize.x / 2 - 100, 150);
+    target.draw(subtitle);
+    
+    // Поле для имени пользователя
+    sf::Text usernameLabel("Username:", font, 28);
+    usernameLabel.setFillColor(sf::Color::White);
+    usernameLabel.setPosition(400, 250);
+    target.draw(usernameLabel);
+    
+    sf::RectangleShape usernameBox(sf::Vector2f(400, 40));
+    usernameBox.setPosition(400, 290);
+    usernameBox.setFillColor(sf::Color(50, 50, 50));
+    usernameBox.setOutlineThickness(2);
+    usernameBox.setOutlineColor(view.usernameActive ? sf::Color::Yellow : sf::Color::White);
+    target.draw(usernameBox);
+    
+    sf::Text usernameText(view.username + (view.usernameActive ? "_" : ""), font, 24);
+    usernameText.setFillColor(sf::Color::White);
+    usernameText.setPosition(410, 295);
+    target.draw(usernameText);
+    
+    // Поле для пароля
+    sf::Text passwordLabel("Password:", font, 28);
+    passwordLabel.setFillColor(sf::Color::White);
+    passwordLabel.setPosition(400, 350);
+    target.draw(passwordLabel);
+    
+    sf::RectangleShape passwordBox(sf::Vector2f(400, 40));
+    passwordBox.setPosition(400, 390);
+    passwordBox.setFillColor(sf::Color(50, 50, 50));
+    passwordBox.setOutlineThickness(2);
+    passwordBox.setOutlineColor(view.passwordActive ? sf::Color::Yellow : sf::Color::White);
+    target.draw(passwordBox);
+    
+    // Отображаем звездочки вместо пароля
+    std::string passwordDisplay(view.passwordLength, '*');
+    if (view.passwordActive) {
+        passwordDisplay += "_";
+    }
+    
+    sf::Text passwordText(passwordDisplay, font, 24);
+    passwordText.setFillColor(sf::Color::White);
+    passwordText.setPosition(410, 395);
+    target.draw(passwordText);
+    
+    // Кнопки
+    batch.render(target, buttons);
+    
+    // Текст ошибки
+    target.draw(errorText);
+    
+    // Подсказка
+    sf::Text hint("Press TAB to switch fields, ENTER to login", font, 18);
+    hint.setFillColor(sf::Color(150, 150, 150));
+    hint.setPosition(400, 550);
+    target.draw(hint);
+}
+
+void Screens::setupTitle(sf::Text& title, const sf::Font& font) {
+    title.setFont(font);
+    title.setString("Memory Game");
+    title.setCharacterSize(72);
+    title.setFillColor(sf::Color::White);
+    title.setStyle(sf::Text::Bold);
+    title.setOutlineColor(sf::Color::Black);
+    title.setOutlineThickness(2);
+    
+    sf::FloatRect titleBounds = title.getLocalBounds();
+    title.setOrigin(titleBounds.left + titleBounds.width / 2.0f,
+                    titleBounds.top + titleBounds.height / 2.0f);
+    title.setPosition(600, 100);
+}
+
+void Screens::setupMainMenuButtons(std::vector<Button>& buttons, const sf::Font& font,
+                                   std::function<void()> onNewGame, std::function<void()> onLeaderboard,
+                                   std::function<void()> onAchievements, std::function<void()> onSettings,
+                                   std::function<void()> onExit) {
+    buttons.clear();
+    
+    float buttonWidth = 300.0f;
+    float buttonHeight = 60.0f;
+    float startY = 300.0f;
+    float spacing = 80.0f;
+    
+    buttons.emplace_back(450.0f, startY, buttonWidth, buttonHeight, "New Game", font, std::move(onNewGame));
+    buttons.emplace_back(450.0f, startY + spacing, buttonWidth, buttonHeight, "Leaderboard", font, std::move(onLeaderboard));
+    buttons.emplace_back(450.0f, startY + spacing * 2, buttonWidth, buttonHeight, "Achievements", font, std::move(onAchievements));
+    buttons.emplace_back(450.0f, startY + spacing * 3, buttonWidth, buttonHeight, "Settings", font, std::move(onSettings));
+    buttons.emplace_back(450.0f, startY + spacing * 4, buttonWidth, buttonHeight, "Exit", font, std::move(onExit));
+    
+    for (auto& button : buttons) {
+        button.setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
+    }
+}
+
+void Screens::drawMainMenu(sf::RenderTarget& target, const sf::Text& title, const std::vector<Button>& buttons) {
+    target.draw(title);
+    
+    for (const auto& button : buttons) {
+        button.renderIdle(target);
+    }
+}
+
+void Screens::setupBackButton(std::vector<Button>& buttons, const sf::Font& font, const sf::Vector2u& canvasSize,
+                              std::function<void()> onBack) {
+    buttons.clear();
+    
+    float buttonWidth = 200.0f;
+    float buttonHeight = 50.0f;
+    float centerX = canvasSize.x / 2 - buttonWidth / 2;
+    float buttonY = canvasSize.y - 100;
+    
+    buttons.emplace_back(centerX, buttonY, buttonWidth, buttonHeight, "Back to Menu", font, std::move(onBack));
+    buttons[0].setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
+}
+
+void Screens::buildLeaderboard(DrawableCache& cache, const sf::Font& font, const sf::Vector2u& canvasSize,
+                               const std::vector<GameRecord>& records) {
+    cache.beginRebuild();
+    
+    // Заголовок
+    sf::Text& title = cache.addText("Leaderboard", font, 64);
+    title.setFillColor(sf::Color::White);
+    title.setStyle(sf::Text::Bold);
+    title.setPosition(canvasSize.x / 2 - 150, 80);
+    
+    if (records.empty()) {
+        sf::Text& noData = cache.addText("No records in leaderboard yet", font, 32);
+        noData.setFillColor(sf::Color(200, 200, 200));
+        noData.setPosition(canvasSize.x / 2 - 150, 200);
+        return;
+    }
+    
+    // Заголовок таблицы
+    sf::Text& header = cache.addText("#  Player              Score   Time   Difficulty", font, 28);
+    header.setFillColor(sf::Color::Yellow);
+    header.setPosition(150, 180);
+    
+    // Список
+    float yPos = 230;
+    int rank = 1;
+    
+    for (const auto& record : records) {
+        std::stringstream line;
+        line << std::setw(2) << std::right << rank << ". ";
+        line << std::setw(15) << std::left << record.playerName.substr(0, 15) << " ";
+        line << std::setw(6) << std::right << record.score << " ";
+        line << std::setw(4) << std::right << (int)record.time << "s ";
+        line << record.difficulty;
+        
+        sf::Text& playerText = cache.addText(line.str(), font, 24);
+        
+        if (rank == 1) playerText.setFillColor(sf::Color(255, 215, 0));
+        else if (rank == 2) playerText.setFillColor(sf::Color(192, 192, 192));
+        else if (rank == 3) playerText.setFillColor(sf::Color(205, 127, 50));
+        else playerText.setFillColor(sf::Color::White);
+        
+        playerText.setPosition(150, yPos);
+        
+        yPos += 40;
+        rank++;
+        if (rank > 10) break;
+    }
+}
+
+void Screens::buildAchievements(DrawableCache& cache, const sf::Font& font, const sf::Vector2u& canvasSize,
+                                const AchievementsView& view) {
+    cache.beginRebuild();
+    
+    // Заголовок
+    sf::Text& title = cache.addText("Achievements", font, 64);
+    title.setFillColor(sf::Color::White);
+    title.setStyle(sf::Text::Bold);
+    title.setPosition(canvasSize.x / 2 - 150, 50);
+    
+    if (!view.achievements) {
+        // Если менеджер достижений не создан
+        sf::Text& noAchievements = cache.addText("Achievements system not initialized", font, 32);
+        noAchievements.setFillColor(sf::Color::Red);
+        noAchievements.setPosition(canvasSize.x / 2 - 200, 200);
+        return;
+    }
+    
+    // Заголовок с именем игрока
+    sf::Text& playerText = cache.addText("Player: " + view.playerName, font, 28);
+    playerText.setFillColor(sf::Color::Yellow);
+    playerText.setPosition(50, 120);
+    
+    // Статистика
+    std::stringstream stats;
+    stats << "Progress: " << view.unlockedCount << "/" << view.totalCount << " (" 
+          << std::fixed << std::setprecision(1) 
+          << (view.totalCount > 0 ? (float)view.unlockedCount / view.totalCount * 100 : 0) << "%)\n"
+          << "Total Score: " << view.totalScore << "\n"
+          << "Unlocked Achievements:";
+    
+    sf::Text& statsText = cache.addText(stats.str(), font, 24);
+    statsText.setFillColor(sf::Color::Yellow);
+    statsText.setPosition(50, 160);
+    
+    // Список достижений
+    const std::vector<Achievement>& allAchievements = *view.achievements;
+    float startY = 250.0f;
+    float spacing = 70.0f;
+    float panelWidth = 700.0f;
+    float panelHeight = 60.0f;
+    
+    // Создаем область для скроллинга
+    sf::RectangleShape& scrollArea = cache.addRect(sf::Vector2f(800, 400));
+    scrollArea.setPosition(40, 240);
+    scrollArea.setFillColor(sf::Color(0, 0, 0, 0)); // Прозрачная
+    scrollArea.setOutlineColor(sf::Color(100, 100, 100));
+    scrollArea.setOutlineThickness(1);
+    
+    // Применяем смещение скроллинга
+    float renderStartY = startY - view.scrollOffset;
+    
+    // Проверяем, есть ли достижения
+    if (allAchievements.empty()) {
+        sf::Text& noData = cache.addText("No achievements data available", font, 28);
+        noData.setFillColor(sf::Color(200, 200, 200));
+        noData.setPosition(canvasSize.x / 2 - 150, renderStartY);
+    } else {
+        // Прокручиваемый список достижений
+        for (size_t i = 0; i < allAchievements.size(); i++) {
+            const auto& achievement = allAchievements[i];
+            
+            float achievementY = renderStartY + i * spacing;
+            
+            // Пропускаем элементы, которые вне области видимости
+            if (achievementY < 240 || achievementY > 640) {
+                continue;
+            }
+            
+            // Фон для достижения
+            sf::RectangleShape& achievementBg = cache.addRect(sf::Vector2f(panelWidth, panelHeight));
+            achievementBg.setPosition(50, achievementY);
+            
+            if (achievement.unlocked) {
+                achievementBg.setFillColor(sf::Color(60, 60, 60, 200));
+                achievementBg.setOutlineColor(sf::Color::Green);
+            } else {
+                achievementBg.setFillColor(sf::Color(40, 40, 40, 200));
+                achievementBg.setOutlineColor(sf::Color(100, 100, 100));
+            }
+            
+            achievementBg.setOutlineThickness(2);
+            
+            // Иконка
+            if (!achievement.icon.empty()) {
+                sf::Text& iconText = cache.addText(achievement.icon, font, 30);
+                iconText.setPosition(60, achievementY + 15);
+                
+                if (achievement.unlocked) {
+                    iconText.setFillColor(achievement.getRarityColor());
+                } else {
+                    iconText.setFillColor(sf::Color(100, 100, 100));
+                }
+            }
+            
+            // Название и описание
+            std::string titleStr = achievement.title;
+            if (achievement.unlocked) {
+                titleStr = "✓ " + titleStr;
+            }
+            
+            sf::Text& titleText = cache.addText(titleStr, font, 22);
+            if (achievement.unlocked) {
+                titleText.setFillColor(sf::Color::White);
+            } else {
+                titleText.setFillColor(sf::Color(150, 150, 150));
+            }
+            titleText.setPosition(100, achievementY + 5);
+            
+            sf::Text& descText = cache.addText(achievement.description, font, 16);
+            if (achievement.unlocked) {
+                descText.setFillColor(sf::Color(200, 200, 200));
+            } else {
+                descText.setFillColor(sf::Color(100, 100, 100));
+            }
+            descText.setPosition(100, achievementY + 32);
+            
+            // Прогресс (только если не разблокировано)
+            if (!achievement.unlocked && achievement.requirement > 1) {
+                std::string progressStr = std::to_string(achievement.progress) + 
+                                         "/" + std::to_string(achievement.requirement);
+                sf::Text& progressText = cache.addText(progressStr, font, 18);
+                progressText.setFillColor(sf::Color::Yellow);
+                progressText.setPosition(600, achievementY + 15);
+                
+                // Прогресс-бар
+                sf::RectangleShape& progressBg = cache.addRect(sf::Vector2f(100, 10));
+                progressBg.setPosition(650, achievementY + 20);
+                progressBg.setFillColor(sf::Color(50, 50, 50));
+                
+                float progressWidth = (float)achievement.progress / achievement.requirement * 100.0f;
+                if (progressWidth > 100) progressWidth = 100;
+                
+                sf::RectangleShape& progressBar = cache.addRect(sf::Vector2f(progressWidth, 10));
+                progressBar.setPosition(650, achievementY + 20);
+                progressBar.setFillColor(achievement.getRarityColor());
+            } else if (achievement.unlocked) {
+                // Для разблокированных - показываем дату или иконку разблокировки
+                sf::Text& unlockedText = cache.addText("UNLOCKED", font, 16);
+                unlockedText.setFillColor(sf::Color::Green);
+                unlockedText.setPosition(650, achievementY + 20);
+            }
+            
+            // Редкость
+            sf::Text& rarityText = cache.addText(achievement.getRarityString(), font, 14);
+            rarityText.setFillColor(achievement.getRarityColor());
+            rarityText.setPosition(750, achievementY + 20);
+        }
+    }
+    
+    // Полоса прокрутки
+    float totalContentHeight = allAchievements.size() * spacing;
+    float visibleHeight = 400;
+    
+    if (totalContentHeight > visibleHeight) {
+        // Рисуем полосу прокрутки
+        sf::RectangleShape& scrollTrack = cache.addRect(sf::Vector2f(10, visibleHeight));
+        scrollTrack.setPosition(770, 240);
+        scrollTrack.setFillColor(sf::Color(50, 50, 50));
+        
+        // Бегунок
+        float thumbHeight = (visibleHeight / totalContentHeight) * visibleHeight;
+        float thumbPosition = (view.scrollOffset / (totalContentHeight - visibleHeight)) * (visibleHeight - thumbHeight);
+        
+        sf::RectangleShape& scrollThumb = cache.addRect(sf::Vector2f(10, thumbHeight));
+        scrollThumb.setPosition(770, 240 + thumbPosition);
+        scrollThumb.setFillColor(sf::Color(150, 150, 150));
+    }
+}
@@ -0,0 +1,157 @@
+#include "GUI/SymbolAtlas.h"
+#include "GUI/FontManager.h"
+#include "GUI/TextureAtlas.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+SymbolAtlas& SymbolAtlas::getInstance() {
+    static SymbolAtlas instance;
+    return instance;
+}
+
+SymbolAtlas::SymbolAtlas() : fallbacksLoaded(false) {}
+
+std::string SymbolAtlas::makeKey(const std::string& symbol, const sf::Font& font, unsigned int characterSize) {
+    // Шрифты живут все время игры, поэтому адрес годится как идентификатор
+    return "symbol:" + std::to_string(reinterpret_cast<std::uintptr_t>(&font)) + ":" +
+           std::to_string(characterSize) + ":" + symbol;
+}
+
+void SymbolAtlas::loadFallbackFonts() {
+    fallbacksLoaded = true;
+    
+    // Шрифты с широким покрытием символов и эмодзи (монохромные - SFML не рисует цветные)
+    std::vector<std::string> fontPaths = {
+        "/usr/share/fonts/truetype/noto/NotoSansSymbols2-Regular.ttf",
+        "/usr/share/fonts/truetype/noto/NotoSansSymbols-Regular.ttf",
+        "/usr/share/fonts/truetype/noto/NotoEmoji-Regular.ttf",
+        "/usr/share/fonts/truetype/ancient-scripts/Symbola_hint.ttf",
+        "/usr/share/fonts/truetype/freefont/FreeSerif.ttf",
+        "/usr/share/fonts/truetype/unifont/unifont.ttf",
+        "assets/fonts/symbols.ttf"
+    };
+    
+    // Шрифты живут в FontManager под своими путями - второй раз с диска не читаются
+    FontManager& fonts = FontManager::getInstance();
+    for (const auto& path : fontPaths) {
+        if (fonts.load(path, {path})) {
+            LOG_DEBUG("assets", "Запасной шрифт символов: " << path);
+            fallbackFonts.push_back(&fonts.getFont(path));
+        }
+    }
+}
+
+bool SymbolAtlas::hasGlyphs(const sf::Font& font, const sf::String& text, unsigned int characterSize) {
+    // Отсутствующий глиф FreeType подменяет глифом .notdef - сравниваем с ним
+    const sf::Glyph& missing = font.getGlyph(0x10FFFD, characterSize, true);
+    
+    for (std::size_t i = 0; i < text.getSize(); i++) {
+        sf::Uint32 codePoint = text[i];
+        // Пробелы и селекторы начертания (U+FE0F) своего изображения не имеют
+        if (codePoint == ' ' || codePoint == 0xFE0F || codePoint == 0x200D) continue;
+        
+        const sf::Glyph& glyph = font.getGlyph(codePoint, characterSize, true);
+        if (glyph.advance == 0 && glyph.bounds.width == 0) return false;
+        if (glyph.advance == missing.advance && glyph.bounds == missing.bounds) return false;
+    }
+    return true;
+}
+
+const sf::Font& SymbolAtlas::pickFont(const sf::String& text, const sf::Font& primary, unsigned int characterSize) {
+    if (hasGlyphs(primary, text, characterSize)) return primary;
+    
+    if (!fallbacksLoaded) loadFallbackFonts();
+    for (const auto& font : fallbackFonts) {
+        if (hasGlyphs(*font, text, characterSize)) return *font;
+    }
+    
+    return primary;
+}
+
+bool SymbolAtlas::rasterize(const std::string& symbol, const sf::Font& font, unsigned int characterSize,
+                            bool upload) {
+    if (!canvas) {
+        canvas = std::make_unique<sf::RenderTexture>();
+        if (!canvas->create(TextureAtlas::CELL_SIZE, TextureAtlas::CELL_SIZE)) {
+            LOG_ERROR("assets", "Не удалось создать холст для символов карт");
+            canvas.reset();
+            return false;
+        }
+    }
+    
+    sf::String text = sf::String::fromUtf8(symbol.begin(), symbol.end());
+    const sf::Font& symbolFont = pickFont(text, font, characterSize);
+    
+    sf::Text symbolText(text, symbolFont, characterSize);
+    symbolText.setFillColor(sf::Color::White);
+    symbolText.setStyle(sf::Text::Bold);
+    
+    sf::FloatRect textBounds = symbolText.getLocalBounds();
+    if (textBounds.width <= 0 || textBounds.height <= 0) return false;
+    
+    // Тот же вид, что у CardSprite::renderSymbol: подложка, тень и сам символ
+    unsigned int maxSide = TextureAtlas::CELL_SIZE;
+    unsigned int width = std::min(static_cast<unsigned int>(std::ceil(textBounds.width + 20)), maxSide);
+    unsigned int height = std::min(static_cast<unsigned int>(std::ceil(textBounds.height + 20)), maxSide);
+    
+    symbolText.setOrigin(textBounds.left + textBounds.width / 2.0f,
+                         textBounds.top + textBounds.height / 2.0f);
+    symbolText.setPosition(width / 2.0f, height / 2.0f);
+    
+    sf::Text symbolShadow = symbolText;
+    symbolShadow.setFillColor(sf::Color(0, 0, 0, 100));
+    symbolShadow.move(2, 2);
+    
+    sf::RectangleShape background(sf::Vector2f(static_cast<float>(width), static_cast<float>(height)));
+    background.setFillColor(sf::Color(255, 255, 255, 100));
+    
+    // Прозрачный белый фон: иначе при смешивании полупрозрачная подложка темнеет
+    canvas->clear(sf::Color(255, 255, 255, 0));
+    canvas->draw(background);
+    canvas->draw(symbolShadow);
+    canvas->draw(symbolText);
+    canvas->display();
+    
+    sf::Image full = canvas->getTexture().copyToImage();
+    sf::Image image;
+    image.create(width, height);
+    image.copy(full, 0, 0, sf::IntRect(0, 0, width, height));
+    
+    return TextureAtlas::getInstance().addImage(makeKey(symbol, font, characterSize), image, upload);
+}
+
+void SymbolAtlas::preload(const std::vector<std::string>& symbols, const sf::Font& font,
+                          unsigned int characterSize) {
+    TextureAtlas& atlas = TextureAtlas::getInstance();
+    size_t added = 0;
+    sf::IntRect region;
+    
+    for (const auto& symbol : symbols) {
+        if (atlas.findRegion(makeKey(symbol, font, characterSize), region)) continue;
+        if (rasterize(symbol, font, characterSize, false)) added++;
+    }
+    
+    if (added > 0) {
+        atlas.flush();
+        LOG_INFO("assets", "🔤 Атлас символов: +" << added << " символов (" << characterSize << " px)");
+    }
+}
+
+bool SymbolAtlas::getRegion(const std::string& symbol, const sf::Font& font, unsigned int characterSize,
+                            sf::IntRect& region) {
+    TextureAtlas& atlas = TextureAtlas::getInstance();
+    std::string key = makeKey(symbol, font, characterSize);
+    
+    if (atlas.findRegion(key, region)) return true;
+    if (!rasterize(symbol, font, characterSize, true)) return false;
+    
+    return atlas.findRegion(key, region);
+}
+
+void SymbolAtlas::clear() {
+    canvas.reset();
+    fallbackFonts.clear();
+    fallbacksLoaded = false;
+}
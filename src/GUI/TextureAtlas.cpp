@@ -0,0 +1,277 @@
+#include "GUI/TextureAtlas.h"
+#include "Logger.h"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+TextureAtlas& TextureAtlas::getInstance() {
+    static TextureAtlas instance;
+    return instance;
+}
+
+TextureAtlas::TextureAtlas()
+    : thumbnails("cache/thumbnails"), columns(0), rowsAllocated(0), uploadedCells(0), prefetchedCells(0) {
+    
+    // MEMORY_GAME_THUMBNAIL_CACHE=<папка> меняет расположение кэша, =0 отключает его
+    const char* cacheEnv = std::getenv("MEMORY_GAME_THUMBNAIL_CACHE");
+    if (cacheEnv) {
+        if (std::string(cacheEnv) == "0") {
+            thumbnails.setEnabled(false);
+        } else {
+            thumbnails = ThumbnailCache(cacheEnv);
+        }
+    }
+    
+    prefetcher.configure(thumbnails, CELL_SIZE - CELL_PADDING * 2);
+}
+
+unsigned int TextureAtlas::getMaxRows() const {
+    return std::min(sf::Texture::getMaximumSize(), 4096u) / CELL_SIZE;
+}
+
+void TextureAtlas::prefetch(const std::vector<std::string>& paths) {
+    std::vector<std::string> missing;
+    for (const auto& path : paths) {
+        if ((indexByPath.count(path) && !stalePaths.count(path)) || failedPaths.count(path)) continue;
+        missing.push_back(path);
+    }
+    prefetcher.request(missing);
+}
+
+void TextureAtlas::preload(const std::vector<std::string>& paths) {
+    size_t before = cells.size();
+    size_t hitsBefore = thumbnails.getHits();
+    size_t prefetchedBefore = prefetchedCells;
+    size_t reloaded = 0;
+    
+    for (const auto& path : paths) {
+        if (stalePaths.count(path)) {
+            if (reloadCell(path)) reloaded++;
+            continue;
+        }
+        if (indexByPath.count(path) || failedPaths.count(path)) continue;
+        addCell(path);
+    }
+    
+    if (reloaded > 0) {
+        LOG_INFO("assets", "🖼 Атлас карт: обновлено измененных изображений: " << reloaded);
+    }
+    if (cells.size() != before || !dirtyCells.empty()) {
+        sync();
+    }
+    
+    if (cells.size() != before) {
+        LOG_INFO("assets", "🖼 Атлас карт: +" << (cells.size() - before) << " изображений ("
+                 << (prefetchedCells - prefetchedBefore) << " готовы заранее, "
+                 << (thumbnails.getHits() - hitsBefore) << " из кэша миниатюр), всего "
+                 << cells.size() << " (" << texture.getSize().x << "x" << texture.getSize().y << ")");
+    }
+}
+
+bool TextureAtlas::getRegion(const std::string& path, sf::IntRect& region) {
+    if (stalePaths.count(path)) {
+        reloadCell(path);
+        sync();
+    }
+    
+    auto it = indexByPath.find(path);
+    if (it == indexByPath.end()) {
+        if (failedPaths.count(path) || !addCell(path)) {
+            return false;
+        }
+        sync();
+        it = indexByPath.find(path);
+    }
+    
+    region = cells[it->second].region;
+    return true;
+}
+
+bool TextureAtlas::findRegion(const std::string& key, sf::IntRect& region) const {
+    auto it = indexByPath.find(key);
+    if (it == indexByPath.end()) return false;
+    
+    region = cells[it->second].region;
+    return true;
+}
+
+bool TextureAtlas::addImage(const std::string& key, const sf::Image& image, bool upload) {
+    if (indexByPath.count(key)) return true;
+    
+    Cell cell;
+    unsigned int maxSide = CELL_SIZE - CELL_PADDING * 2;
+    sf::Vector2u size = image.getSize();
+    if (size.x > maxSide || size.y > maxSide) {
+        cell.image = ThumbnailCache::downscale(image, maxSide);
+    } else {
+        cell.image = image;
+    }
+    
+    if (!placeCell(key, std::move(cell))) {
+        return false;
+    }
+    
+    if (upload) sync();
+    return true;
+}
+
+void TextureAtlas::flush() {
+    if (uploadedCells != cells.size() || !dirtyCells.empty()) {
+        sync();
+    }
+}
+
+void TextureAtlas::invalidate(const std::string& path) {
+    failedPaths.erase(path);
+    prefetcher.forget(path);
+    if (indexByPath.count(path)) {
+        stalePaths.insert(path);
+    }
+}
+
+bool TextureAtlas::loadImage(const std::string& path, sf::Image& image) {
+    if (prefetcher.take(path, image)) {
+        prefetchedCells++;
+        return true;
+    }
+    return thumbnails.load(path, CELL_SIZE - CELL_PADDING * 2, image);
+}
+
+bool TextureAtlas::addCell(const std::string& path) {
+    Cell cell;
+    if (!loadImage(path, cell.image)) {
+        failedPaths.insert(path);
+        return false;
+    }
+    
+    return placeCell(path, std::move(cell));
+}
+
+bool TextureAtlas::reloadCell(const std::string& path) {
+    stalePaths.erase(path);
+    size_t index = indexByPath[path];
+    
+    sf::Image image;
+    if (!loadImage(path, image)) {
+        // Файл удален или испорчен - ячейка остается пустой до конца сессии
+        indexByPath.erase(path);
+        failedPaths.insert(path);
+        return false;
+    }
+    
+    // Ячейка та же, меняется только размер картинки внутри нее
+    Cell& cell = cells[index];
+    sf::Vector2u size = image.getSize();
+    cell.region.width = static_cast<int>(size.x);
+    cell.region.height = static_cast<int>(size.y);
+    cell.image = extrudeToCell(image);
+    
+    if (index < uploadedCells) {
+        dirtyCells.push_back(index);
+    }
+    return true;
+}
+
+bool TextureAtlas::placeCell(const std::string& key, Cell cell) {
+    if (columns == 0) {
+        // Ширина атласа ограничена, дальше он растет только вниз
+        columns = std::min(sf::Texture::getMaximumSize(), 2048u) / CELL_SIZE;
+    }
+    
+    if (cells.size() >= static_cast<size_t>(columns) * getMaxRows()) {
+        LOG_WARNING("assets", "Атлас карт заполнен, изображение пропущено: " << key);
+        failedPaths.insert(key);
+        return false;
+    }
+    
+    // Картинка прижата к углу ячейки с отступом, чтобы сглаживание не цепляло соседей
+    size_t index = cells.size();
+    unsigned int cellX = static_cast<unsigned int>(index % columns) * CELL_SIZE + CELL_PADDING;
+    unsigned int cellY = static_cast<unsigned int>(index / columns) * CELL_SIZE + CELL_PADDING;
+    sf::Vector2u size = cell.image.getSize();
+    cell.region = sf::IntRect(cellX, cellY, size.x, size.y);
+    cell.image = extrudeToCell(cell.image);
+    
+    cells.push_back(std::move(cell));
+    indexByPath[key] = index;
+    return true;
+}
+
+void TextureAtlas::sync() {
+    unsigned int neededRows = static_cast<unsigned int>((cells.size() + columns - 1) / columns);
+    
+    if (neededRows > rowsAllocated) {
+        // Растим с запасом, чтобы следующая тема не пересоздавала текстуру
+        unsigned int newRows = std::max(neededRows, rowsAllocated * 2);
+        newRows = std::min(newRows, getMaxRows());
+        
+        if (!texture.create(columns * CELL_SIZE, newRows * CELL_SIZE)) {
+            LOG_ERROR("assets", "Не удалось создать текстуру атласа " << columns * CELL_SIZE
+                      << "x" << newRows * CELL_SIZE);
+            return;
+        }
+        texture.setSmooth(true);
+        
+        rowsAllocated = newRows;
+        uploadedCells = 0;
+        dirtyCells.clear();
+    }
+    
+    if (uploadedCells == cells.size() && dirtyCells.empty()) return;
+    
+    for (size_t index : dirtyCells) {
+        const Cell& cell = cells[index];
+        texture.update(cell.image, cell.region.left - CELL_PADDING, cell.region.top - CELL_PADDING);
+    }
+    dirtyCells.clear();
+    
+    for (; uploadedCells < cells.size(); uploadedCells++) {
+        const Cell& cell = cells[uploadedCells];
+        texture.update(cell.image, cell.region.left - CELL_PADDING, cell.region.top - CELL_PADDING);
+    }
+    
+    // Мипмапы нужны при отдаленной камере: без них мелкие карты мерцают.
+    // Глубже MAX_MIP_LEVEL отступа ячейки не хватает - дальше GL берет этот уровень
+    if (texture.generateMipmap()) {
+        sf::Texture::bind(&texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, MAX_MIP_LEVEL);
+        sf::Texture::bind(nullptr);
+    }
+}
+
+sf::Image TextureAtlas::extrudeToCell(const sf::Image& image) {
+    sf::Vector2u size = image.getSize();
+    const sf::Uint8* src = image.getPixelsPtr();
+    std::vector<sf::Uint8> pixels(static_cast<size_t>(CELL_SIZE) * CELL_SIZE * 4);
+    
+    sf::Image cell;
+    if (size.x == 0 || size.y == 0) {
+        cell.create(CELL_SIZE, CELL_SIZE, pixels.data());
+        return cell;
+    }
+    
+    for (unsigned int y = 0; y < CELL_SIZE; y++) {
+        int sourceY = std::clamp(static_cast<int>(y) - static_cast<int>(CELL_PADDING), 0, static_cast<int>(size.y) - 1);
+        for (unsigned int x = 0; x < CELL_SIZE; x++) {
+            int sourceX = std::clamp(static_cast<int>(x) - static_cast<int>(CELL_PADDING), 0, static_cast<int>(size.x) - 1);
+            const sf::Uint8* from = src + (static_cast<size_t>(sourceY) * size.x + sourceX) * 4;
+            std::copy(from, from + 4, &pixels[(static_cast<size_t>(y) * CELL_SIZE + x) * 4]);
+        }
+    }
+    
+    cell.create(CELL_SIZE, CELL_SIZE, pixels.data());
+    return cell;
+}
+
+void TextureAtlas::clear() {
+    prefetcher.stop();
+    texture = sf::Texture();
+    cells.clear();
+    indexByPath.clear();
+    failedPaths.clear();
+    stalePaths.clear();
+    dirtyCells.clear();
+    rowsAllocated = 0;
+    uploadedCells = 0;
+}
@@ -0,0 +1,188 @@
+#include "GUI/ThumbnailCache.h"
+#include "Logger.h"
+#include "AssetPack.h"
+#include "GUI/JpegDecoder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // FNV-1a: стабилен между запусками и сборками, в отличие от std::hash
+    unsigned long long fnv1a(const std::string& data, unsigned long long hash = 1469598103934665603ULL) {
+        for (unsigned char c : data) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
+ThumbnailCache::ThumbnailCache(const std::string& directory)
+    : directory(directory), scanned(false), enabled(true), hits(0), misses(0) {
+}
+
+void ThumbnailCache::scanDirectory() {
+    scanned = true;
+    
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(directory, error)) {
+        std::string fileName = entry.path().filename().string();
+        size_t separator = fileName.find('_');
+        if (separator != std::string::npos) {
+            cachedFiles[fileName.substr(0, separator + 1)].push_back(fileName);
+        }
+    }
+}
+
+bool ThumbnailCache::makeCachePath(const std::string& sourcePath, unsigned int maxSide,
+                                   std::string& cachePath, std::string& pathPrefix) const {
+    std::string version;
+    
+    // У ресурса из архива версия - хеш содержимого из индекса, stat не нужен
+    if (const AssetPack::Entry* packed = AssetPack::getInstance().find(sourcePath)) {
+        version = "pack:" + std::to_string(packed->hash) + ":" + std::to_string(maxSide);
+    } else {
+        std::error_code error;
+        auto modified = fs::last_write_time(sourcePath, error);
+        if (error) return false;
+        
+        auto fileSize = fs::file_size(sourcePath, error);
+        if (error) return false;
+        
+        version = std::to_string(modified.time_since_epoch().count()) + ":" +
+                  std::to_string(fileSize) + ":" + std::to_string(maxSide);
+    }
+    
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx_", fnv1a(sourcePath));
+    pathPrefix = name;
+    std::snprintf(name, sizeof(name), "%016llx.png", fnv1a(version));
+    cachePath = (fs::path(directory) / (pathPrefix + name)).string();
+    return true;
+}
+
+bool ThumbnailCache::load(const std::string& sourcePath, unsigned int maxSide, sf::Image& thumbnail) {
+    std::string cachePath;
+    std::string pathPrefix;
+    bool cacheable = enabled && makeCachePath(sourcePath, maxSide, cachePath, pathPrefix);
+    
+    if (cacheable) {
+        std::error_code error;
+        if (fs::exists(cachePath, error) && thumbnail.loadFromFile(cachePath)) {
+            hits++;
+            return true;
+        }
+    }
+    
+    // Промах: декодируем исходник один раз и сохраняем уменьшенную копию.
+    // JPEG сразу декодируется почти в размер миниатюры, остальное - через SFML целиком
+    sf::Image source;
+    const AssetPack::Entry* packed = AssetPack::getInstance().find(sourcePath);
+    JpegDecoder::Result jpeg = JpegDecoder::Result::UNSUPPORTED;
+    if (packed) {
+        jpeg = JpegDecoder::decode(packed->data, packed->size, maxSide, source);
+    } else if (JpegDecoder::isJpegPath(sourcePath)) {
+        jpeg = JpegDecoder::decodeFile(sourcePath, maxSide, source);
+    }
+    
+    if (jpeg == JpegDecoder::Result::CORRUPT) {
+        // SFML декодировал бы оборванный файл тоже, но целиком и с серыми полосами
+        LOG_WARNING("assets", "Поврежденный JPEG, картинка пропущена: " << sourcePath);
+        return false;
+    }
+    
+    if (jpeg == JpegDecoder::Result::UNSUPPORTED) {
+        bool decoded = packed ? source.loadFromMemory(packed->data, packed->size)
+                              : source.loadFromFile(sourcePath);
+        if (!decoded) {
+            return false;
+        }
+    }
+    
+    misses++;
+    thumbnail = downscale(source, maxSide);
+    
+    if (cacheable) {
+        store(cachePath, pathPrefix, thumbnail);
+    }
+    return true;
+}
+
+void ThumbnailCache::store(const std::string& cachePath, const std::string& pathPrefix, const sf::Image& thumbnail) {
+    std::error_code error;
+    fs::create_directories(directory, error);
+    if (error) {
+        LOG_WARNING("assets", "Не удалось создать папку кэша миниатюр: " << directory);
+        enabled = false;
+        return;
+    }
+    
+    if (!scanned) {
+        scanDirectory();
+    }
+    
+    // Удаляем устаревшие миниатюры того же исходника
+    std::string cacheName = fs::path(cachePath).filename().string();
+    std::vector<std::string>& known = cachedFiles[pathPrefix];
+    for (const auto& fileName : known) {
+        if (fileName != cacheName) {
+            fs::remove(fs::path(directory) / fileName, error);
+        }
+    }
+    known.assign(1, cacheName);
+    
+    if (!thumbnail.saveToFile(cachePath)) {
+        LOG_WARNING("assets", "Не удалось сохранить миниатюру: " << cachePath);
+    }
+}
+
+sf::Image ThumbnailCache::downscale(const sf::Image& source, unsigned int maxSide) {
+    sf::Vector2u srcSize = source.getSize();
+    if (srcSize.x <= maxSide && srcSize.y <= maxSide) {
+        return source;
+    }
+    
+    float scale = static_cast<float>(maxSide) / std::max(srcSize.x, srcSize.y);
+    unsigned int dstWidth = std::max(1u, static_cast<unsigned int>(std::round(srcSize.x * scale)));
+    unsigned int dstHeight = std::max(1u, static_cast<unsigned int>(std::round(srcSize.y * scale)));
+    
+    // Усреднение по блоку исходных пикселей - дешевле и чище, чем
+    // масштабирование спрайта при каждой отрисовке
+    const sf::Uint8* src = source.getPixelsPtr();
+    std::vector<sf::Uint8> dst(static_cast<size_t>(dstWidth) * dstHeight * 4);
+    
+    for (unsigned int y = 0; y < dstHeight; y++) {
+        unsigned int y0 = y * srcSize.y / dstHeight;
+        unsigned int y1 = std::max(y0 + 1, (y + 1) * srcSize.y / dstHeight);
+        
+        for (unsigned int x = 0; x < dstWidth; x++) {
+            unsigned int x0 = x * srcSize.x / dstWidth;
+            unsigned int x1 = std::max(x0 + 1, (x + 1) * srcSize.x / dstWidth);
+            
+            unsigned int sum[4] = {0, 0, 0, 0};
+            for (unsigned int sy = y0; sy < y1; sy++) {
+                const sf::Uint8* row = src + (static_cast<size_t>(sy) * srcSize.x + x0) * 4;
+                for (unsigned int sx = x0; sx < x1; sx++, row += 4) {
+                    sum[0] += row[0];
+                    sum[1] += row[1];
+                    sum[2] += row[2];
+                    sum[3] += row[3];
+                }
+            }
+            
+            unsigned int count = (y1 - y0) * (x1 - x0);
+            sf::Uint8* out = &dst[(static_cast<size_t>(y) * dstWidth + x) * 4];
+            for (int c = 0; c < 4; c++) {
+                out[c] = static_cast<sf::Uint8>(sum[c] / count);
+            }
+        }
+    }
+    
+    sf::Image result;
+    result.create(dstWidth, dstHeight, dst.data());
+    return result;
+}
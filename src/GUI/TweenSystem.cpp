@@ -0,0 +1,86 @@
+#include "GUI/TweenSystem.h"
+#include "GUI/CardSprite.h"
+#include <algorithm>
+
+void TweenSystem::start(CardSprite* target, Property property, float duration, float delay) {
+    if (!target) return;
+    
+    duration = std::max(duration, 0.001f);
+    
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (targets[i] == target && properties[i] == property) {
+            elapsed[i] = -delay;
+            durations[i] = duration;
+            return;
+        }
+    }
+    
+    targets.push_back(target);
+    properties.push_back(property);
+    elapsed.push_back(-delay);
+    durations.push_back(duration);
+    
+    // Начальное значение выставляем сразу, чтобы не мигнуть конечным кадром
+    switch (property) {
+        case Property::Flip: target->setFlipProgress(0.0f); break;
+        case Property::Pulse: target->setPulseProgress(0.0f); break;
+        case Property::Fade: target->setFadeProgress(0.0f); break;
+    }
+}
+
+void TweenSystem::update(float deltaTime) {
+    // Идем с конца, чтобы завершенные твины удалялись перестановкой с последним
+    for (size_t i = targets.size(); i-- > 0;) {
+        elapsed[i] += deltaTime;
+        if (elapsed[i] < 0.0f) continue;
+        
+        float t = std::min(elapsed[i] / durations[i], 1.0f);
+        
+        switch (properties[i]) {
+            case Property::Flip: targets[i]->setFlipProgress(t); break;
+            case Property::Pulse: targets[i]->setPulseProgress(t); break;
+            case Property::Fade: targets[i]->setFadeProgress(t); break;
+        }
+        
+        if (t >= 1.0f) {
+            removeAt(i);
+        }
+    }
+}
+
+void TweenSystem::sample(float aheadTime) {
+    for (size_t i = 0; i < targets.size(); i++) {
+        float time = elapsed[i] + aheadTime;
+        if (time < 0.0f) continue;
+        
+        float t = std::min(time / durations[i], 1.0f);
+        
+        switch (properties[i]) {
+            case Property::Flip: targets[i]->setFlipProgress(t); break;
+            case Property::Pulse: targets[i]->setPulseProgress(t); break;
+            case Property::Fade: targets[i]->setFadeProgress(t); break;
+        }
+    }
+}
+
+void TweenSystem::removeAt(size_t index) {
+    size_t last = targets.size() - 1;
+    if (index != last) {
+        targets[index] = targets[last];
+        properties[index] = properties[last];
+        elapsed[index] = elapsed[last];
+        durations[index] = durations[last];
+    }
+    
+    targets.pop_back();
+    properties.pop_back();
+    elapsed.pop_back();
+    durations.pop_back();
+}
+
+void TweenSystem::clear() {
+    targets.clear();
+    properties.clear();
+    elapsed.clear();
+    durations.clear();
+}
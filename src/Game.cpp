@@ -1,11 +1,17 @@
 #include "Game.h"
-#include <iostream>
+#include "Logger.h"
+#include "AssetPack.h"
+#include "GUI/TextureAtlas.h"
+#include "GUI/SymbolAtlas.h"
+#include "GUI/FontManager.h"
+#include "GUI/Screens.h"
 #include <algorithm>
 #include <random>
 #include <sstream>
 #include <sys/stat.h>
 #include <iomanip>
 #include <ctime>
+#include <cstdio>
 #include <clocale>
 #include <fstream>
 #include <filesystem>
@@ -35,7 +41,20 @@ bool Game::isRunningInDockerInternal() {
 }
 
 Game::Game() 
-    : window(sf::VideoMode(1200, 800), "Memory Game", sf::Style::Titlebar | sf::Style::Close | sf::Style::Resize),
+    : window(sf::VideoMode(CANVAS_WIDTH, CANVAS_HEIGHT), "Memory Game", sf::Style::Titlebar | sf::Style::Close | sf::Style::Resize),
+      mainFont(FontManager::getInstance().getFont("main")),
+      useFixedTimestep(false),
+      fixedTimestep(1.0f / 60.0f),
+      maxFrameTime(0.25f),
+      interpolationAlpha(1.0f),
+      idleRendering(true),
+      needsRedraw(true),
+      lastRenderedState(GameState::LOGIN_SCREEN),
+      idleWaitTimeout(sf::milliseconds(500)),
+      cachedLeaderboardVersion(0),
+      gameOverCacheState(GameState::EXIT),
+      gameOverButton(nullptr),
+      hoverState(GameState::EXIT),
       brightness(1.0f),
       currentVideoMode(1200, 800),
       currentVideoModeIndex(2),
@@ -55,6 +74,13 @@ Game::Game()
       cardFlipTime(0.3f),
       cardFlipProgress(0.0f),
       isFlipping(false),
+      boardMaxZoom(8.0f),
+      isPanningBoard(false),
+      customRows(20),
+      customCols(20),
+      matchParticles(512),
+      victoryParticles(2048),
+      mismatchDelay(0.8f),
       firstCard(nullptr),
       secondCard(nullptr),
       isChecking(false),
@@ -66,12 +92,56 @@ Game::Game()
       achievementsScrollOffset(0.0f),
       achievementsTotalHeight(0.0f)
 {
-    std::cout << "=== ИНИЦИАЛИЗАЦИЯ ИГРЫ ===" << std::endl;
-    std::cout << "Начинаем с экрана регистрации/логина" << std::endl;
+    LOG_INFO("game", "=== ИНИЦИАЛИЗАЦИЯ ИГРЫ ===");
+    LOG_INFO("game", "Начинаем с экрана регистрации/логина");
+    
+    applyCanvasViewport(window.getSize().x, window.getSize().y);
+    
+    // Фиксированный шаг логики включается переменной окружения
+    // MEMORY_GAME_TICK_RATE=<Гц>, например MEMORY_GAME_TICK_RATE=120
+    char* tickRate = std::getenv("MEMORY_GAME_TICK_RATE");
+    if (tickRate) {
+        int rate = std::atoi(tickRate);
+        if (rate >= 10 && rate <= 1000) {
+            useFixedTimestep = true;
+            fixedTimestep = 1.0f / rate;
+            LOG_INFO("game", "Fixed timestep: " << rate << " ticks/s");
+        } else {
+            LOG_WARNING("game", "⚠ Invalid MEMORY_GAME_TICK_RATE: " << tickRate);
+        }
+    }
     
-    window.setFramerateLimit(60);
+    applyFrameRateMode();
     window.setKeyRepeatEnabled(false);
     
+    // Перерисовка статичных экранов только по событиям;
+    // MEMORY_GAME_IDLE_RENDER=0 возвращает отрисовку каждого кадра
+    char* idleRender = std::getenv("MEMORY_GAME_IDLE_RENDER");
+    if (idleRender && std::string(idleRender) == "0") {
+        idleRendering = false;
+        LOG_INFO("game", "Idle rendering disabled");
+    }
+    
+    // Размер поля для сложности Custom, например MEMORY_GAME_CUSTOM_BOARD=40x60
+    char* customBoard = std::getenv("MEMORY_GAME_CUSTOM_BOARD");
+    if (customBoard) {
+        int customR = 0, customC = 0;
+        if (std::sscanf(customBoard, "%dx%d", &customR, &customC) == 2 &&
+            customR >= 2 && customC >= 2 && customR <= 200 && customC <= 200) {
+            customRows = customR;
+            customCols = customC;
+            LOG_INFO("game", "Custom board: " << customRows << "x" << customCols);
+        } else {
+            LOG_WARNING("game", "⚠ Invalid MEMORY_GAME_CUSTOM_BOARD: " << customBoard);
+        }
+    }
+    
+    // Трасса профайлера: *.json - формат chrome://tracing, иначе CSV
+    char* tracePath = std::getenv("MEMORY_GAME_PROFILE_TRACE");
+    if (tracePath) {
+        profiler.openTrace(tracePath);
+    }
+    
     // Доступные разрешения
     availableVideoModes = {
         sf::VideoMode(800, 600),
@@ -82,17 +152,22 @@ Game::Game()
         sf::VideoMode(1920, 1080)
     };
     
+    // Перезаписанная на диске картинка темы декодируется заново при следующей партии
+    themeIndex.setChangeHandler([](const std::string& path) {
+        TextureAtlas::getInstance().invalidate(path);
+    });
+    
     // Загрузка ресурсов
-    std::cout << "Загрузка ресурсов..." << std::endl;
+    LOG_INFO("game", "Загрузка ресурсов...");
     loadResources();
-    std::cout << "Ресурсы загружены" << std::endl;
+    LOG_INFO("game", "Ресурсы загружены");
     
     // Кнопка сдачи
     surrenderButton = Button(950, 700, 200, 50, "Surrender", mainFont, 
                             [this]() { surrenderGame(); });
     surrenderButton.setColors(sf::Color(220, 20, 60), sf::Color(255, 0, 0), sf::Color(178, 34, 34));
     
-    std::cout << "Initializing PostgreSQL database..." << std::endl;
+    LOG_INFO("db", "Initializing PostgreSQL database...");
     
     // Определяем строку подключения
     std::string connStr;
@@ -101,48 +176,52 @@ Game::Game()
     char* dbUrl = std::getenv("DATABASE_URL");
     if (dbUrl) {
         connStr = dbUrl;
-        std::cout << "Using DATABASE_URL from environment" << std::endl;
+        LOG_INFO("db", "Using DATABASE_URL from environment");
     } 
     // Проверяем, в Docker ли мы
     else if (isRunningInDockerInternal()) {
         connStr = "host=postgres dbname=memory_game_db user=game_user password=game_password";
-        std::cout << "🐳 Docker environment detected, connecting to PostgreSQL container" << std::endl;
+        LOG_INFO("db", "🐳 Docker environment detected, connecting to PostgreSQL container");
     } 
     // Локальная разработка
     else {
         connStr = "host=localhost dbname=memory_game_db user=game_user password=game_password";
-        std::cout << "💻 Local environment, connecting to local PostgreSQL" << std::endl;
+        LOG_INFO("db", "💻 Local environment, connecting to local PostgreSQL");
     }
     
-    std::cout << "Connection string: " << connStr << std::endl;
+    LOG_INFO("db", "Connection string: " << connStr);
     
     // Пытаемся подключиться к PostgreSQL
     try {
         database = std::make_unique<Database>(connStr);
         
         if (database->initialize()) {
-            std::cout << "✅ PostgreSQL database initialized successfully" << std::endl;
+            LOG_INFO("db", "✅ PostgreSQL database initialized successfully");
             
             // Тестируем подключение
             auto testRecords = database->getTopScores(1);
-            std::cout << "📊 Records in database: " << testRecords.size() << std::endl;
+            LOG_INFO("db", "📊 Records in database: " << testRecords.size());
+            
+            // Таблица лидеров читается в фоне через отдельное подключение
+            leaderboardService = std::make_unique<LeaderboardService>(connStr, 10);
+            leaderboardService->start();
             
         } else {
-            std::cout << "⚠ Failed to initialize PostgreSQL database" << std::endl;
-            std::cout << "Error: " << database->getLastError() << std::endl;
+            LOG_WARNING("db", "⚠ Failed to initialize PostgreSQL database");
+            LOG_INFO("db", "Error: " << database->getLastError());
             database = nullptr;
         }
     } catch (const std::exception& e) {
-        std::cerr << "❌ Exception while connecting to PostgreSQL: " << e.what() << std::endl;
+        LOG_ERROR("db", "❌ Exception while connecting to PostgreSQL: " << e.what());
         database = nullptr;
     }
     
     // Инициализация UserManager
     userManager = std::make_unique<UserManager>(connStr);
     if (userManager->initialize()) {
-        std::cout << "✅ UserManager initialized with PostgreSQL" << std::endl;
+        LOG_INFO("db", "✅ UserManager initialized with PostgreSQL");
     } else {
-        std::cout << "⚠ Failed to initialize UserManager" << std::endl;
+        LOG_WARNING("db", "⚠ Failed to initialize UserManager");
     }
     
     // Настройка UI
@@ -162,19 +241,24 @@ Game::Game()
     musicPlayer = std::make_unique<MusicPlayer>();
     std::filesystem::create_directories("saves");
     
-    std::cout << "=== ИНИЦИАЛИЗАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
-    std::cout << "Текущее состояние: LOGIN_SCREEN" << std::endl;
+    LOG_INFO("game", "=== ИНИЦИАЛИЗАЦИЯ ЗАВЕРШЕНА ===");
+    LOG_INFO("game", "Текущее состояние: LOGIN_SCREEN");
 }
 
 Game::~Game() {
+    // Текстуры атласов освобождаем, пока жив контекст окна
+    SymbolAtlas::getInstance().clear();
+    TextureAtlas::getInstance().clear();
+    FontManager::getInstance().clear();
+    
     // Сохраняем достижения перед выходом
     if (achievementManager && player) {
         std::string saveDir = "saves/";
         std::filesystem::create_directories(saveDir);
         
         std::string achievementsPath = saveDir + "achievements_" + player->getName() + ".dat";
-        std::cout << "\n💾 SAVING achievements on exit..." << std::endl;
-        std::cout << "   Path: " << achievementsPath << std::endl;
+        LOG_INFO("game", "💾 SAVING achievements on exit...");
+        LOG_INFO("game", "   Path: " << achievementsPath);
         
         achievementManager->saveToFile(achievementsPath);
         
@@ -188,25 +272,17 @@ Game::~Game() {
         userManager->logout();
     }
     
-    std::cout << "Игра завершена." << std::endl;
+    LOG_INFO("game", "Игра завершена.");
 }
 
 void Game::setupLoginUI() {
-    loginButtons.clear();
-    
-    float centerX = window.getSize().x / 2 - 150;
-    float startY = 450.0f;
-    float spacing = 70.0f;
-    
     usernameInput = "";
     passwordInput = "";
     
-    // Кнопка входа
-    loginButtons.emplace_back(
-        centerX, startY, 300.0f, 60.0f,
-        "Login", mainFont,
+    Screens::setupLoginButtons(loginButtons, mainFont, getCanvasSize(),
+        // Кнопка входа
         [this]() {
-            std::cout << "Нажата кнопка Login" << std::endl;
+            LOG_DEBUG("game", "Нажата кнопка Login");
             
             if (usernameInput.empty() || passwordInput.empty()) {
                 loginErrorText.setString("Please enter username and password");
@@ -215,7 +291,7 @@ void Game::setupLoginUI() {
             
             std::string errorMsg;
             if (userManager->login(usernameInput, passwordInput, errorMsg)) {
-                std::cout << "✅ Вход успешен!" << std::endl;
+                LOG_INFO("game", "✅ Вход успешен!");
                 
                 // Создаем объект игрока
                 player = std::make_unique<Player>(usernameInput);
@@ -243,33 +319,23 @@ void Game::setupLoginUI() {
                 loginErrorText.setString("");
                 
             } else {
-                std::cout << "❌ Ошибка входа: " << errorMsg << std::endl;
+                LOG_WARNING("game", "❌ Ошибка входа: " << errorMsg);
                 loginErrorText.setString(errorMsg);
             }
-        }
-    );
-    
-    // Кнопка регистрации
-    loginButtons.emplace_back(
-        centerX, startY + spacing, 300.0f, 60.0f,
-        "Register", mainFont,
+        },
+        // Кнопка регистрации
         [this]() {
-            std::cout << "Переход на экран регистрации" << std::endl;
+            LOG_DEBUG("game", "Переход на экран регистрации");
             currentState = GameState::REGISTER_SCREEN;
             usernameInput = "";
             passwordInput = "";
             emailInput = "";
             confirmPasswordInput = "";
             registerErrorText.setString("");
-        }
-    );
-    
-    // Кнопка гостевого режима
-    loginButtons.emplace_back(
-        centerX, startY + spacing * 2, 300.0f, 60.0f,
-        "Play as Guest", mainFont,
+        },
+        // Кнопка гостевого режима
         [this]() {
-            std::cout << "Запуск гостевого режима" << std::endl;
+            LOG_DEBUG("game", "Запуск гостевого режима");
             player = std::make_unique<Player>("Guest");
             
             // Для гостя тоже создаем achievementManager
@@ -280,22 +346,14 @@ void Game::setupLoginUI() {
         }
     );
     
-    // Настройка цвета кнопок
-    loginButtons[0].setColors(sf::Color(0, 150, 0), sf::Color(0, 200, 0), sf::Color(0, 100, 0));
-    loginButtons[1].setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
-    loginButtons[2].setColors(sf::Color(128, 128, 128), sf::Color(160, 160, 160), sf::Color(96, 96, 96));
-    
     // Текст ошибки
-    loginErrorText.setFont(mainFont);
-    loginErrorText.setCharacterSize(20);
-    loginErrorText.setFillColor(sf::Color::Red);
-    loginErrorText.setPosition(centerX, startY + spacing * 3);
+    Screens::setupLoginErrorText(loginErrorText, mainFont, getCanvasSize());
 }
 
 void Game::setupRegisterUI() {
     registerButtons.clear();
     
-    float centerX = window.getSize().x / 2 - 150;
+    float centerX = getCanvasSize().x / 2 - 150;
     float startY = 550.0f;
     float spacing = 70.0f;
     
@@ -304,7 +362,7 @@ void Game::setupRegisterUI() {
         centerX, startY, 300.0f, 60.0f,
         "Create Account", mainFont,
         [this]() {
-            std::cout << "Нажата кнопка Create Account" << std::endl;
+            LOG_DEBUG("game", "Нажата кнопка Create Account");
             
             if (usernameInput.empty() || passwordInput.empty() || 
                 emailInput.empty() || confirmPasswordInput.empty()) {
@@ -329,7 +387,7 @@ void Game::setupRegisterUI() {
             
             std::string errorMsg;
             if (userManager->registerUser(usernameInput, passwordInput, emailInput, errorMsg)) {
-                std::cout << "✅ Регистрация успешна! Автоматический вход..." << std::endl;
+                LOG_INFO("game", "✅ Регистрация успешна! Автоматический вход...");
                 
                 // Автоматический вход после регистрации
                 if (userManager->login(usernameInput, passwordInput, errorMsg)) {
@@ -363,7 +421,7 @@ void Game::setupRegisterUI() {
                     registerErrorText.setString("");
                 }
             } else {
-                std::cout << "❌ Ошибка регистрации: " << errorMsg << std::endl;
+                LOG_WARNING("game", "❌ Ошибка регистрации: " << errorMsg);
                 registerErrorText.setString(errorMsg);
             }
         }
@@ -374,7 +432,7 @@ void Game::setupRegisterUI() {
         centerX, startY + spacing, 300.0f, 60.0f,
         "Back to Login", mainFont,
         [this]() {
-            std::cout << "Возврат на экран входа" << std::endl;
+            LOG_DEBUG("game", "Возврат на экран входа");
             currentState = GameState::LOGIN_SCREEN;
             usernameInput = "";
             passwordInput = "";
@@ -396,20 +454,167 @@ void Game::setupRegisterUI() {
 }
 
 void Game::run() {
-    std::cout << "=== НАЧАЛО ИГРОВОГО ЦИКЛА ===" << std::endl;
+    LOG_INFO("game", "=== НАЧАЛО ИГРОВОГО ЦИКЛА ===");
+    
+    if (useFixedTimestep) {
+        runFixedTimestep();
+        return;
+    }
+    
     sf::Clock clock;
     
     while (window.isOpen()) {
+        // На статичном экране спим до ввода, а не рисуем 60 раз в секунду
+        if (canIdle()) {
+            waitForActivity();
+            clock.restart();
+        }
+        
         sf::Time deltaTime = clock.restart();
+        profiler.beginFrame();
+        
+        {
+            ProfileScope scope(profiler, "handleEvents");
+            handleEvents();
+        }
+        {
+            ProfileScope scope(profiler, "update");
+            update(deltaTime.asSeconds());
+        }
+        
+        if (isRedrawNeeded()) {
+            render();
+            frameStats.addFrame(deltaTime.asSeconds());
+        }
+        
+        profiler.endFrame();
+        reportFrameStats();
+    }
+}
+
+void Game::runFixedTimestep() {
+    sf::Clock clock;
+    float accumulator = 0.0f;
+    
+    while (window.isOpen()) {
+        if (canIdle()) {
+            waitForActivity();
+            clock.restart();
+            accumulator = 0.0f;
+        }
+        
+        float frameTime = clock.restart().asSeconds();
+        
+        // Ограничиваем долгий кадр, чтобы не догонять логику бесконечно
+        int droppedSteps = 0;
+        if (frameTime > maxFrameTime) {
+            droppedSteps = static_cast<int>((frameTime - maxFrameTime) / fixedTimestep);
+            frameTime = maxFrameTime;
+        }
+        accumulator += frameTime;
+        profiler.beginFrame();
+        
+        {
+            ProfileScope scope(profiler, "handleEvents");
+            handleEvents();
+        }
+        
+        int steps = 0;
+        while (accumulator >= fixedTimestep) {
+            ProfileScope scope(profiler, "update");
+            update(fixedTimestep);
+            accumulator -= fixedTimestep;
+            steps++;
+        }
+        
+        // Доля следующего шага для интерполяции при отрисовке
+        interpolationAlpha = accumulator / fixedTimestep;
+        
+        if (isRedrawNeeded()) {
+            render();
+            frameStats.addFrame(frameTime, steps, droppedSteps);
+        }
+        
+        profiler.endFrame();
+        reportFrameStats();
+    }
+}
+
+bool Game::isStaticScreen(GameState state) const {
+    switch (state) {
+        case GameState::LOGIN_SCREEN:
+        case GameState::REGISTER_SCREEN:
+        case GameState::MAIN_MENU:
+        case GameState::SETUP:
+        case GameState::LEADERBOARD:
+        case GameState::SETTINGS:
+        case GameState::ACHIEVEMENTS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool Game::canIdle() const {
+    // Ждать можно, только если экран статичен, уже отрисован
+    // и нет отложенных действий, которым нужен ход времени
+    return idleRendering && !isRedrawNeeded() && scheduler.isEmpty();
+}
+
+bool Game::isRedrawNeeded() const {
+    if (!idleRendering || !isStaticScreen(currentState)) {
+        return true;
+    }
+    return needsRedraw || currentState != lastRenderedState;
+}
+
+void Game::waitForActivity() {
+    // SFML не умеет waitEvent с таймаутом, поэтому опрашиваем очередь
+    // короткими снами. Таймаут нужен, чтобы периодически проверять данные
+    sf::Clock waitClock;
+    sf::Event event;
+    
+    while (window.isOpen()) {
+        if (window.pollEvent(event)) {
+            sf::Vector2f mousePos = getCanvasMousePosition();
+            processEvent(event, mousePos);
+            return;
+        }
+        
+        if (waitClock.getElapsedTime() >= idleWaitTimeout) {
+            return;
+        }
         
-        handleEvents();
-        update(deltaTime.asSeconds());
-        render();
+        // Простой тратим на прогрев глифов вместо сна
+        FontManager& fonts = FontManager::getInstance();
+        if (fonts.hasPendingWarmUp()) {
+            fonts.warmUpPending(sf::milliseconds(8));
+        } else {
+            sf::sleep(sf::milliseconds(10));
+        }
+    }
+}
+
+void Game::applyFrameRateMode() {
+    if (useFixedTimestep) {
+        // Отрисовка идет с частотой дисплея, логика - со своим шагом
+        window.setFramerateLimit(0);
+        window.setVerticalSyncEnabled(true);
+    } else {
+        window.setVerticalSyncEnabled(false);
+        window.setFramerateLimit(60);
+    }
+}
+
+void Game::reportFrameStats() {
+    if (frameStats.isReportReady()) {
+        LOG_INFO("render", frameStats.buildReport());
+        frameStats.reset();
     }
 }
 
 void Game::startNewGame() {
-    std::cout << "\n=== НАЧАЛО НОВОЙ ИГРЫ ===" << std::endl;
+    LOG_DEBUG("game", "=== НАЧАЛО НОВОЙ ИГРЫ ===");
     currentState = GameState::ENTER_NAME;
     playerNameInput = "";
     isEnteringName = true;
@@ -430,7 +635,6 @@ void Game::resumeGame() {
     if (currentState == GameState::PAUSED) {
         currentState = GameState::PLAYING;
         isGameActive = true;
-        gameClock.restart();
     }
 }
 
@@ -439,16 +643,16 @@ void Game::showLeaderboard() {
 }
 
 void Game::showAchievements() {
-    std::cout << "=== SHOW ACHIEVEMENTS ===" << std::endl;
+    LOG_DEBUG("game", "=== SHOW ACHIEVEMENTS ===");
     
     // Проверяем, есть ли менеджер достижений
     if (!achievementManager) {
-        std::cout << "❌ Achievement manager not initialized!" << std::endl;
+        LOG_WARNING("game", "❌ Achievement manager not initialized!");
         
         // Пытаемся создать менеджер достижений
         if (player) {
             achievementManager = std::make_unique<AchievementManager>(player->getName());
-            std::cout << "✅ Created achievement manager for: " << player->getName() << std::endl;
+            LOG_INFO("game", "✅ Created achievement manager for: " << player->getName());
             
             // Загружаем достижения
             std::string achievementsPath;
@@ -460,14 +664,14 @@ void Game::showAchievements() {
             achievementManager->loadFromFile(achievementsPath);
         } else if (userManager && userManager->isUserLoggedIn()) {
             achievementManager = std::make_unique<AchievementManager>(userManager->getCurrentUsername());
-            std::cout << "✅ Created achievement manager for: " << userManager->getCurrentUsername() << std::endl;
+            LOG_INFO("game", "✅ Created achievement manager for: " << userManager->getCurrentUsername());
         } else {
             achievementManager = std::make_unique<AchievementManager>("Guest");
-            std::cout << "✅ Created achievement manager for Guest" << std::endl;
+            LOG_INFO("game", "✅ Created achievement manager for Guest");
         }
     } else {
         // Обновляем данные достижений
-        std::cout << "✅ Achievement manager already exists" << std::endl;
+        LOG_DEBUG("game", "✅ Achievement manager already exists");
         
         // Загружаем свежие данные
         if (player) {
@@ -478,10 +682,11 @@ void Game::showAchievements() {
                 achievementsPath = "achievements_" + player->getName() + ".dat";
             }
             achievementManager->loadFromFile(achievementsPath);
-            std::cout << "✅ Reloaded achievements from: " << achievementsPath << std::endl;
+            LOG_INFO("game", "✅ Reloaded achievements from: " << achievementsPath);
         }
     }
     
+    achievementsCache.invalidate();
     currentState = GameState::ACHIEVEMENTS;
 }
 
@@ -496,7 +701,7 @@ void Game::exitGame() {
 void Game::surrenderGame() {
     if (!isGameActive) return;
     
-    std::cout << "Игрок сдался!" << std::endl;
+    LOG_INFO("game", "Игрок сдался!");
     
     if (soundManager) {
         soundManager->playGameLose();
@@ -517,20 +722,40 @@ void Game::surrenderGame() {
         record.date = getCurrentDate();
         record.difficulty = getDifficultyString();
         
-        if (database) {
-            database->saveGame(record);
+        if (database && database->saveGame(record) && leaderboardService) {
+            leaderboardService->invalidate();
         }
     }
     
+    gameOverCache.invalidate();
     currentState = GameState::GAME_OVER_LOSE;
 }
 
 void Game::setDifficulty(Difficulty diff) {
     difficulty = diff;
+    prefetchCardImages();
 }
 
 void Game::setTheme(CardTheme theme) {
     currentTheme = theme;
+    prefetchCardImages();
+}
+
+void Game::prefetchCardImages() {
+    // Пока игрок в настройках, картинки будущей партии декодируются в фоне,
+    // и createCardSprites остается только залить их в атлас.
+    // Набор тот же, что возьмет initializeCards: первые картинки темы по числу пар
+    int boardRows = 0;
+    int boardCols = 0;
+    getBoardSize(difficulty, boardRows, boardCols);
+    size_t pairs = static_cast<size_t>(boardRows * boardCols / 2);
+    
+    std::vector<std::string> images = themeIndex.getImages(getThemeImageDir(currentTheme));
+    if (images.size() > pairs) {
+        images.resize(pairs);
+    }
+    
+    TextureAtlas::getInstance().prefetch(images);
 }
 
 void Game::saveGameResult() {
@@ -547,8 +772,14 @@ void Game::saveGameResult() {
     record.date = getCurrentDate();
     record.difficulty = getDifficultyString();
     
-    database->saveGame(record);
-    std::cout << "💾 Результат сохранен в БД" << std::endl;
+    if (database->saveGame(record)) {
+        LOG_INFO("game", "💾 Результат сохранен в БД");
+        
+        // Новый результат должен сразу попасть в таблицу лидеров
+        if (leaderboardService) {
+            leaderboardService->invalidate();
+        }
+    }
 }
 
 std::string Game::getCurrentDate() const {
@@ -566,6 +797,7 @@ std::string Game::getDifficultyString() const {
         case Difficulty::MEDIUM: return "Medium";
         case Difficulty::HARD: return "Hard";
         case Difficulty::EXPERT: return "Expert";
+        case Difficulty::CUSTOM: return "Custom";
         default: return "Unknown";
     }
 }
@@ -580,54 +812,28 @@ sf::Color Game::getDifficultyColor() const {
             return sf::Color(255, 165, 0);
         case Difficulty::EXPERT:
             return sf::Color::Red;
+        case Difficulty::CUSTOM:
+            return sf::Color(0, 191, 255);
         default:
             return sf::Color::White;
     }
 }
 
 void Game::getImagePathsForTheme(CardTheme theme, std::vector<std::string>& imagePaths) {
-    std::string themeFolder;
-    
-    switch (theme) {
-        case CardTheme::ANIMALS: themeFolder = "animals"; break;
-        case CardTheme::FRUITS: themeFolder = "fruits"; break;
-        case CardTheme::EMOJI: themeFolder = "emoji"; break;
-        case CardTheme::MEMES: themeFolder = "memes"; break;
-        case CardTheme::SYMBOLS: themeFolder = "symbols"; break;
-        default: themeFolder = "animals"; break;
-    }
+    std::string imageDir = getThemeImageDir(theme);
+    LOG_DEBUG("game", "📁 Поиск изображений в: " << imageDir);
     
-    std::string imageDir = "assets/images/" + themeFolder + "/";
-    std::cout << "📁 Поиск изображений в: " << imageDir << std::endl;
+    imagePaths = themeIndex.getImages(imageDir);
     
-    imagePaths.clear();
+    for (size_t i = 0; i < imagePaths.size() && i < 5; i++) {
+        LOG_DEBUG("game", "   ✅ " << fs::path(imagePaths[i]).filename().string());
+    }
+    if (imagePaths.size() > 5) {
+        LOG_DEBUG("game", "   ... и еще " << (imagePaths.size() - 5) << " файлов");
+    }
+    LOG_DEBUG("game", "Найдено файлов: " << imagePaths.size());
     
-    try {
-        int foundCount = 0;
-        for (const auto& entry : fs::directory_iterator(imageDir)) {
-            if (entry.is_regular_file()) {
-                std::string ext = entry.path().extension().string();
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-                
-                if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp") {
-                    imagePaths.push_back(entry.path().string());
-                    foundCount++;
-                    
-                    if (foundCount <= 5) {
-                        std::cout << "   ✅ " << entry.path().filename() << std::endl;
-                    }
-                }
-            }
-        }
-        
-        if (foundCount > 5) {
-            std::cout << "   ... и еще " << (foundCount - 5) << " файлов" << std::endl;
-        }
-        
-        std::cout << "Найдено файлов: " << foundCount << std::endl;
-        
-    } catch (const std::exception& e) {
-        std::cout << "❌ Ошибка доступа к папке: " << e.what() << std::endl;
+    if (imagePaths.empty()) {
         // Создаем тестовые пути
         for (int i = 1; i <= 18; i++) {
             imagePaths.push_back(imageDir + "image" + std::to_string(i) + ".png");
@@ -636,14 +842,66 @@ void Game::getImagePathsForTheme(CardTheme theme, std::vector<std::string>& imag
 }
 
 void Game::renderMainMenu() {
-    window.draw(titleText);
+    ProfileScope scope(profiler, "renderMainMenu");
+    
+    renderMenuLayer(mainMenuButtons, [this](sf::RenderTarget& target) {
+        Screens::drawMainMenu(target, titleText, mainMenuButtons);
+    });
+}
+
+bool Game::isLayeredScreen(GameState state) const {
+    return state == GameState::MAIN_MENU || state == GameState::SETUP || state == GameState::SETTINGS;
+}
+
+unsigned long long Game::getMenuLayerKey(const std::vector<Button>& buttons) const {
+    // Все, от чего зависит статичная часть текущего меню
+    unsigned long long key = static_cast<unsigned long long>(currentState);
+    key = key * 1000003ULL + static_cast<unsigned long long>(brightness * 100);
+    key = key * 1000003ULL + static_cast<unsigned long long>(difficulty);
+    key = key * 1000003ULL + static_cast<unsigned long long>(currentTheme);
+    key = key * 1000003ULL + (player ? std::hash<std::string>()(player->getName()) : 0);
+    
+    for (const auto& button : buttons) {
+        key = key * 31ULL + button.getVersion();
+    }
+    return key;
+}
+
+void Game::renderMenuLayer(const std::vector<Button>& buttons,
+                           const std::function<void(sf::RenderTarget&)>& drawStatic) {
+    unsigned long long key = getMenuLayerKey(buttons);
+    
+    // Слой хранится в пикселях области вывода, чтобы не терять четкость при растяжении холста
+    sf::Vector2u layerSize = getCanvasPixelSize();
+    if (menuLayer.needsRebuild(key, layerSize)) {
+        sf::RenderTarget* target = menuLayer.begin(key, layerSize,
+            sf::View(sf::FloatRect(0, 0, static_cast<float>(CANVAS_WIDTH), static_cast<float>(CANVAS_HEIGHT))));
+        
+        if (!target) {
+            // Без слоя рисуем как раньше - напрямую в окно
+            window.draw(background);
+            drawStatic(window);
+            for (const auto& button : buttons) {
+                if (button.isHovered()) button.render(window);
+            }
+            return;
+        }
+        
+        target->draw(background);
+        drawStatic(*target);
+        menuLayer.end();
+    }
     
-    for (auto& button : mainMenuButtons) {
-        button.render(window);
+    // Фон, заголовки и кнопки - одним спрайтом; поверх только кнопка под курсором
+    menuLayer.render(window);
+    for (const auto& button : buttons) {
+        if (button.isHovered()) button.render(window);
     }
 }
 
 void Game::renderNameInput() {
+    ProfileScope scope(profiler, "renderNameInput");
+    
     // Заголовок
     sf::Text title;
     title.setFont(mainFont);
@@ -655,16 +913,16 @@ void Game::renderNameInput() {
     sf::FloatRect titleBounds = title.getLocalBounds();
     title.setOrigin(titleBounds.left + titleBounds.width / 2.0f,
                     titleBounds.top + titleBounds.height / 2.0f);
-    title.setPosition(window.getSize().x / 2, 200);
+    title.setPosition(getCanvasSize().x / 2, 200);
     window.draw(title);
     
     // Поле ввода
-    nameInputBox.setPosition(window.getSize().x / 2 - 200, 300);
+    nameInputBox.setPosition(getCanvasSize().x / 2 - 200, 300);
     window.draw(nameInputBox);
     
     // Текст ввода
     nameInputText.setString(playerNameInput + "_");
-    nameInputText.setPosition(window.getSize().x / 2 - 180, 315);
+    nameInputText.setPosition(getCanvasSize().x / 2 - 180, 315);
     window.draw(nameInputText);
     
     // Подсказка
@@ -677,42 +935,48 @@ void Game::renderNameInput() {
     sf::FloatRect hintBounds = hint.getLocalBounds();
     hint.setOrigin(hintBounds.left + hintBounds.width / 2.0f,
                    hintBounds.top + hintBounds.height / 2.0f);
-    hint.setPosition(window.getSize().x / 2, 400);
+    hint.setPosition(getCanvasSize().x / 2, 400);
     window.draw(hint);
 }
 
 void Game::renderSetupMenu() {
-    // Заголовок
-    sf::Text setupTitle("Game Setup", mainFont, 48);
-    setupTitle.setFillColor(sf::Color::White);
-    setupTitle.setStyle(sf::Text::Bold);
-    setupTitle.setPosition(window.getSize().x / 2 - 100, 100);
-    window.draw(setupTitle);
-    
-    // Информация о текущих настройках
-    std::stringstream settingsInfo;
-    settingsInfo << "Current settings:\n";
-    settingsInfo << "• Player: " << (player ? player->getName() : "Not set") << "\n";
-    settingsInfo << "• Difficulty: " << getDifficultyString() << "\n";
-    settingsInfo << "• Theme: ";
-    switch (currentTheme) {
-        case CardTheme::ANIMALS: settingsInfo << "Animals"; break;
-        case CardTheme::FRUITS: settingsInfo << "Fruits"; break;
-        case CardTheme::EMOJI: settingsInfo << "Emoji"; break;
-        case CardTheme::MEMES: settingsInfo << "Memes"; break;
-        case CardTheme::SYMBOLS: settingsInfo << "Symbols"; break;
-    }
-    
-    sf::Text infoText(settingsInfo.str(), mainFont, 24);
-    infoText.setFillColor(sf::Color(200, 200, 200));
-    infoText.setPosition(window.getSize().x / 2 - 200, 150);
-    window.draw(infoText);
-    
-    // Кнопки
-    for (auto& button : setupButtons) button.render(window);
+    ProfileScope scope(profiler, "renderSetupMenu");
+    
+    renderMenuLayer(setupButtons, [this](sf::RenderTarget& target) {
+        // Заголовок
+        sf::Text setupTitle("Game Setup", mainFont, 48);
+        setupTitle.setFillColor(sf::Color::White);
+        setupTitle.setStyle(sf::Text::Bold);
+        setupTitle.setPosition(getCanvasSize().x / 2 - 100, 100);
+        target.draw(setupTitle);
+        
+        // Информация о текущих настройках
+        std::stringstream settingsInfo;
+        settingsInfo << "Current settings:\n";
+        settingsInfo << "• Player: " << (player ? player->getName() : "Not set") << "\n";
+        settingsInfo << "• Difficulty: " << getDifficultyString() << "\n";
+        settingsInfo << "• Theme: ";
+        switch (currentTheme) {
+            case CardTheme::ANIMALS: settingsInfo << "Animals"; break;
+            case CardTheme::FRUITS: settingsInfo << "Fruits"; break;
+            case CardTheme::EMOJI: settingsInfo << "Emoji"; break;
+            case CardTheme::MEMES: settingsInfo << "Memes"; break;
+            case CardTheme::SYMBOLS: settingsInfo << "Symbols"; break;
+        }
+        
+        sf::Text infoText(settingsInfo.str(), mainFont, 24);
+        infoText.setFillColor(sf::Color(200, 200, 200));
+        infoText.setPosition(getCanvasSize().x / 2 - 200, 150);
+        target.draw(infoText);
+        
+        // Кнопки
+        for (const auto& button : setupButtons) button.renderIdle(target);
+    });
 }
 
 void Game::renderGame() {
+    ProfileScope scope(profiler, "renderGame");
+    
     // Заголовок и статистика
     window.draw(titleText);
     window.draw(statsText);
@@ -720,192 +984,193 @@ void Game::renderGame() {
     window.draw(scoreText);
     window.draw(difficultyText);
     
-    // Карточки
-    for (auto& card : cards) {
-        card->render(window);
-    }
+    // Карточки - видимая часть поля одним-двумя вызовами draw через камеру поля
+    sf::View uiView = window.getView();
+    window.setView(boardView);
+    boardRenderer.update(cards, boardLayout, getVisibleBoardRange());
+    boardRenderer.render(window);
+    matchParticles.render(window);
+    window.setView(uiView);
     
     // Кнопки
-    for (auto& button : gameButtons) {
-        button.render(window);
-    }
+    buttonBatch.render(window, gameButtons);
     
     surrenderButton.render(window);
 }
 
-void Game::renderPauseMenu() {
-    // Полупрозрачный фон
-    sf::RectangleShape overlay(sf::Vector2f(window.getSize().x, window.getSize().y));
-    overlay.setFillColor(sf::Color(0, 0, 0, 150));
-    window.draw(overlay);
+std::vector<Button>* Game::getScreenButtons(GameState state) {
+    switch (state) {
+        case GameState::MAIN_MENU: return &mainMenuButtons;
+        case GameState::SETUP: return &setupButtons;
+        case GameState::PLAYING: return &gameButtons;
+        case GameState::PAUSED: return &pauseButtons;
+        case GameState::LEADERBOARD: return &leaderboardButtons;
+        case GameState::ACHIEVEMENTS: return &achievementsButtons;
+        case GameState::SETTINGS: return &settingsButtons;
+        default: return nullptr;
+    }
+}
+
+void Game::updateButtonHover(const sf::Vector2f& mousePos) {
+    bool changed = false;
     
-    sf::Text pauseText("PAUSED", mainFont, 72);
-    pauseText.setFillColor(sf::Color::Yellow);
-    pauseText.setStyle(sf::Text::Bold);
-    sf::FloatRect pauseBounds = pauseText.getLocalBounds();
-    pauseText.setOrigin(pauseBounds.left + pauseBounds.width / 2.0f,
-                        pauseBounds.top + pauseBounds.height / 2.0f);
-    pauseText.setPosition(window.getSize().x / 2, 200);
-    window.draw(pauseText);
+    std::vector<Button>* buttons = getScreenButtons(currentState);
+    if (buttons) {
+        for (auto& button : *buttons) {
+            changed |= button.update(mousePos);
+        }
+    }
+    if (currentState == GameState::PLAYING) {
+        changed |= surrenderButton.update(mousePos);
+    }
     
-    for (auto& button : pauseButtons) {
-        button.render(window);
+    if (changed) {
+        markDirty();
     }
 }
 
-void Game::renderGameOverLose() {
-    // Game Over текст
-    sf::Text gameOverText("GAME OVER", mainFont, 72);
-    gameOverText.setFillColor(sf::Color::Red);
-    gameOverText.setStyle(sf::Text::Bold);
-    
-    sf::FloatRect bounds = gameOverText.getLocalBounds();
-    gameOverText.setOrigin(bounds.left + bounds.width / 2.0f,
-                          bounds.top + bounds.height / 2.0f);
-    gameOverText.setPosition(window.getSize().x / 2, 200);
-    window.draw(gameOverText);
-    
-    // Сообщение
-    sf::Text messageText("Better luck next time!", mainFont, 36);
-    messageText.setFillColor(sf::Color(200, 200, 200));
-    
-    sf::FloatRect messageBounds = messageText.getLocalBounds();
-    messageText.setOrigin(messageBounds.left + messageBounds.width / 2.0f,
-                         messageBounds.top + messageBounds.height / 2.0f);
-    messageText.setPosition(window.getSize().x / 2, 300);
-    window.draw(messageText);
-    
-    // Статистика
-    if (player) {
-        std::stringstream stats;
-        stats << "Player: " << player->getName() << "\n\n";
-        stats << "Final Score: " << player->getScore() << "\n";
-        stats << "Progress: " << matchedPairs << "/" << totalPairs << " pairs\n";
-        stats << "Time: " << (int)elapsedTime.asSeconds() << " seconds\n";
-        stats << "Difficulty: " << getDifficultyString();
+void Game::releaseButtons(const sf::Vector2f& mousePos, const sf::Event& event) {
+    // onClick мог сменить экран - отпускание получают кнопки всех экранов,
+    // иначе нажатая кнопка прежнего экрана осталась бы с activeColor
+    for (std::vector<Button>* buttons : {&loginButtons, &registerButtons, &mainMenuButtons, &setupButtons,
+                                         &gameButtons, &pauseButtons, &leaderboardButtons,
+                                         &achievementsButtons, &settingsButtons}) {
+        for (auto& button : *buttons) {
+            button.handleEvent(event, mousePos);
+        }
+    }
+    surrenderButton.handleEvent(event, mousePos);
+}
+
+void Game::renderPauseMenu() {
+    ProfileScope scope(profiler, "renderPauseMenu");
+    
+    if (!pauseCache.isValid()) {
+        pauseCache.beginRebuild();
         
-        sf::Text statsText(stats.str(), mainFont, 32);
-        statsText.setFillColor(sf::Color::White);
-        statsText.setPosition(window.getSize().x / 2 - 200, 350);
-        window.draw(statsText);
+        // Полупрозрачный фон
+        sf::RectangleShape& overlay = pauseCache.addRect(sf::Vector2f(getCanvasSize().x, getCanvasSize().y));
+        overlay.setFillColor(sf::Color(0, 0, 0, 150));
+        
+        sf::Text& pauseText = pauseCache.addText("PAUSED", mainFont, 72);
+        pauseText.setFillColor(sf::Color::Yellow);
+        pauseText.setStyle(sf::Text::Bold);
+        sf::FloatRect pauseBounds = pauseText.getLocalBounds();
+        pauseText.setOrigin(pauseBounds.left + pauseBounds.width / 2.0f,
+                            pauseBounds.top + pauseBounds.height / 2.0f);
+        pauseText.setPosition(getCanvasSize().x / 2, 200);
     }
     
-    // Кнопка продолжения
-    sf::RectangleShape continueButton(sf::Vector2f(300, 60));
-    continueButton.setPosition(window.getSize().x / 2 - 150, window.getSize().y - 150);
+    pauseCache.render(window);
+    
+    buttonBatch.render(window, pauseButtons);
+}
+
+void Game::renderGameOverLose() {
+    ProfileScope scope(profiler, "renderGameOverLose");
+    
+    if (!gameOverCache.isValid() || gameOverCacheState != GameState::GAME_OVER_LOSE) {
+        gameOverCache.beginRebuild();
+        gameOverCacheState = GameState::GAME_OVER_LOSE;
+        
+        // Game Over текст
+        sf::Text& gameOverText = gameOverCache.addText("GAME OVER", mainFont, 72);
+        gameOverText.setFillColor(sf::Color::Red);
+        gameOverText.setStyle(sf::Text::Bold);
+        
+        sf::FloatRect bounds = gameOverText.getLocalBounds();
+        gameOverText.setOrigin(bounds.left + bounds.width / 2.0f,
+                              bounds.top + bounds.height / 2.0f);
+        gameOverText.setPosition(getCanvasSize().x / 2, 200);
+        
+        // Сообщение
+        sf::Text& messageText = gameOverCache.addText("Better luck next time!", mainFont, 36);
+        messageText.setFillColor(sf::Color(200, 200, 200));
+        
+        sf::FloatRect messageBounds = messageText.getLocalBounds();
+        messageText.setOrigin(messageBounds.left + messageBounds.width / 2.0f,
+                             messageBounds.top + messageBounds.height / 2.0f);
+        messageText.setPosition(getCanvasSize().x / 2, 300);
+        
+        // Статистика
+        if (player) {
+            std::stringstream stats;
+            stats << "Player: " << player->getName() << "\n\n";
+            stats << "Final Score: " << player->getScore() << "\n";
+            stats << "Progress: " << matchedPairs << "/" << totalPairs << " pairs\n";
+            stats << "Time: " << (int)elapsedTime.asSeconds() << " seconds\n";
+            stats << "Difficulty: " << getDifficultyString();
+            
+            sf::Text& statsText = gameOverCache.addText(stats.str(), mainFont, 32);
+            statsText.setFillColor(sf::Color::White);
+            statsText.setPosition(getCanvasSize().x / 2 - 200, 350);
+        }
+        
+        addGameOverButton("Return to Menu");
+    }
     
-    sf::Vector2f mousePos = static_cast<sf::Vector2f>(sf::Mouse::getPosition(window));
-    bool isMouseOverButton = continueButton.getGlobalBounds().contains(mousePos);
+    // Подсветка кнопки продолжения - единственное, что меняется между кадрами
+    sf::Vector2f mousePos = getCanvasMousePosition();
+    bool isMouseOverButton = gameOverButton->getGlobalBounds().contains(mousePos);
     
     if (isMouseOverButton) {
-        continueButton.setFillColor(sf::Color(70, 130, 180));
-        continueButton.setOutlineColor(sf::Color::Yellow);
+        gameOverButton->setFillColor(sf::Color(70, 130, 180));
+        gameOverButton->setOutlineColor(sf::Color::Yellow);
     } else {
-        continueButton.setFillColor(sf::Color(50, 100, 150));
-        continueButton.setOutlineColor(sf::Color::White);
+        gameOverButton->setFillColor(sf::Color(50, 100, 150));
+        gameOverButton->setOutlineColor(sf::Color::White);
     }
     
+    gameOverCache.render(window);
+}
+
+void Game::addGameOverButton(const std::string& label) {
+    // Кнопка продолжения
+    sf::RectangleShape& continueButton = gameOverCache.addRect(sf::Vector2f(300, 60));
+    continueButton.setPosition(getCanvasSize().x / 2 - 150, getCanvasSize().y - 150);
     continueButton.setOutlineThickness(2);
-    window.draw(continueButton);
+    gameOverButton = &continueButton;
     
-    sf::Text continueText("Return to Menu", mainFont, 28);
+    sf::Text continueText(label, mainFont, 28);
     continueText.setFillColor(sf::Color::White);
     sf::FloatRect continueBounds = continueText.getLocalBounds();
     continueText.setOrigin(continueBounds.left + continueBounds.width / 2.0f,
                           continueBounds.top + continueBounds.height / 2.0f);
-    continueText.setPosition(window.getSize().x / 2, window.getSize().y - 120);
+    continueText.setPosition(getCanvasSize().x / 2, getCanvasSize().y - 120);
     
     // Тень
-    sf::Text shadowText = continueText;
+    sf::Text& shadowText = gameOverCache.addText(label, mainFont, 28);
     shadowText.setFillColor(sf::Color(0, 0, 0, 150));
+    shadowText.setOrigin(continueText.getOrigin());
+    shadowText.setPosition(continueText.getPosition());
     shadowText.move(2, 2);
-    window.draw(shadowText);
     
-    window.draw(continueText);
+    sf::Text& mainText = gameOverCache.addText(label, mainFont, 28);
+    mainText.setFillColor(sf::Color::White);
+    mainText.setOrigin(continueText.getOrigin());
+    mainText.setPosition(continueText.getPosition());
 }
 
 void Game::renderLoginScreen() {
-    // Заголовок
-    sf::Text title("Memory Game", mainFont, 72);
-    title.setFillColor(sf::Color::White);
-    title.setStyle(sf::Text::Bold);
-    title.setPosition(window.getSize().x / 2 - 150, 50);
-    window.draw(title);
-    
-    sf::Text subtitle("Login to your account", mainFont, 36);
-    subtitle.setFillColor(sf::Color(200, 200, 200));
-    subtitle.setPosition(window.getSize().x / 2 - 100, 150);
-    window.draw(subtitle);
-    
-    // Поле для имени пользователя
-    sf::Text usernameLabel("Username:", mainFont, 28);
-    usernameLabel.setFillColor(sf::Color::White);
-    usernameLabel.setPosition(400, 250);
-    window.draw(usernameLabel);
-    
-    sf::RectangleShape usernameBox(sf::Vector2f(400, 40));
-    usernameBox.setPosition(400, 290);
-    usernameBox.setFillColor(sf::Color(50, 50, 50));
-    usernameBox.setOutlineThickness(2);
-    usernameBox.setOutlineColor(activeInputField == InputField::USERNAME ? 
-                                sf::Color::Yellow : sf::Color::White);
-    window.draw(usernameBox);
-    
-    sf::Text usernameText(usernameInput + (activeInputField == InputField::USERNAME ? "_" : ""), 
-                         mainFont, 24);
-    usernameText.setFillColor(sf::Color::White);
-    usernameText.setPosition(410, 295);
-    window.draw(usernameText);
-    
-    // Поле для пароля
-    sf::Text passwordLabel("Password:", mainFont, 28);
-    passwordLabel.setFillColor(sf::Color::White);
-    passwordLabel.setPosition(400, 350);
-    window.draw(passwordLabel);
-    
-    sf::RectangleShape passwordBox(sf::Vector2f(400, 40));
-    passwordBox.setPosition(400, 390);
-    passwordBox.setFillColor(sf::Color(50, 50, 50));
-    passwordBox.setOutlineThickness(2);
-    passwordBox.setOutlineColor(activeInputField == InputField::PASSWORD ? 
-                                sf::Color::Yellow : sf::Color::White);
-    window.draw(passwordBox);
-    
-    // Отображаем звездочки вместо пароля
-    std::string passwordDisplay;
-    for (size_t i = 0; i < passwordInput.length(); i++) {
-        passwordDisplay += "*";
-    }
-    if (activeInputField == InputField::PASSWORD) {
-        passwordDisplay += "_";
-    }
-    
-    sf::Text passwordText(passwordDisplay, mainFont, 24);
-    passwordText.setFillColor(sf::Color::White);
-    passwordText.setPosition(410, 395);
-    window.draw(passwordText);
-    
-    // Кнопки
-    for (auto& button : loginButtons) {
-        button.render(window);
-    }
+    ProfileScope scope(profiler, "renderLoginScreen");
     
-    // Текст ошибки
-    window.draw(loginErrorText);
+    Screens::LoginView view;
+    view.username = usernameInput;
+    view.passwordLength = passwordInput.length();
+    view.usernameActive = activeInputField == InputField::USERNAME;
+    view.passwordActive = activeInputField == InputField::PASSWORD;
     
-    // Подсказка
-    sf::Text hint("Press TAB to switch fields, ENTER to login", mainFont, 18);
-    hint.setFillColor(sf::Color(150, 150, 150));
-    hint.setPosition(400, 550);
-    window.draw(hint);
+    Screens::drawLogin(window, mainFont, getCanvasSize(), view, loginButtons, buttonBatch, loginErrorText);
 }
 
 void Game::renderRegisterScreen() {
+    ProfileScope scope(profiler, "renderRegisterScreen");
+    
     // Заголовок
     sf::Text title("Create Account", mainFont, 72);
     title.setFillColor(sf::Color::White);
     title.setStyle(sf::Text::Bold);
-    title.setPosition(window.getSize().x / 2 - 150, 50);
+    title.setPosition(getCanvasSize().x / 2 - 150, 50);
     window.draw(title);
     
     // Поле для имени пользователя
@@ -1003,9 +1268,7 @@ void Game::renderRegisterScreen() {
     window.draw(confirmText);
     
     // Кнопки
-    for (auto& button : registerButtons) {
-        button.render(window);
-    }
+    buttonBatch.render(window, registerButtons);
     
     // Текст ошибки
     window.draw(registerErrorText);
@@ -1018,78 +1281,49 @@ void Game::renderRegisterScreen() {
 }
 
 void Game::renderLeaderboard() {
-    // Заголовок
-    sf::Text title("Leaderboard", mainFont, 64);
-    title.setFillColor(sf::Color::White);
-    title.setStyle(sf::Text::Bold);
-    title.setPosition(window.getSize().x / 2 - 150, 80);
-    window.draw(title);
-    
-    // Получаем лучшие результаты
-    auto topPlayers = database ? database->getTopScores(10) : std::vector<GameRecord>();
+    ProfileScope scope(profiler, "renderLeaderboard");
     
-    if (topPlayers.empty()) {
-        sf::Text noData("No records in leaderboard yet", mainFont, 32);
-        noData.setFillColor(sf::Color(200, 200, 200));
-        noData.setPosition(window.getSize().x / 2 - 150, 200);
-        window.draw(noData);
-    } else {
-        // Заголовок таблицы
-        sf::Text header("#  Player              Score   Time   Difficulty", mainFont, 28);
-        header.setFillColor(sf::Color::Yellow);
-        header.setPosition(150, 180);
-        window.draw(header);
-        
-        // Список
-        float yPos = 230;
-        int rank = 1;
-        
-        for (const auto& record : topPlayers) {
-            std::stringstream line;
-            line << std::setw(2) << std::right << rank << ". ";
-            line << std::setw(15) << std::left << record.playerName.substr(0, 15) << " ";
-            line << std::setw(6) << std::right << record.score << " ";
-            line << std::setw(4) << std::right << (int)record.time << "s ";
-            line << record.difficulty;
-            
-            sf::Text playerText(line.str(), mainFont, 24);
-            
-            if (rank == 1) playerText.setFillColor(sf::Color(255, 215, 0));
-            else if (rank == 2) playerText.setFillColor(sf::Color(192, 192, 192));
-            else if (rank == 3) playerText.setFillColor(sf::Color(205, 127, 50));
-            else playerText.setFillColor(sf::Color::White);
-            
-            playerText.setPosition(150, yPos);
-            window.draw(playerText);
-            
-            yPos += 40;
-            rank++;
-            if (rank > 10) break;
-        }
+    // Берем готовый снимок - запрос к БД идет в фоновом потоке.
+    // Строки таблицы пересобираем только при новой версии снимка
+    unsigned int snapshotVersion = leaderboardService ? leaderboardService->getVersion() : 0;
+    if (!leaderboardCache.isValid() || snapshotVersion != cachedLeaderboardVersion) {
+        cachedLeaderboard = leaderboardService ? leaderboardService->getSnapshot() : std::vector<GameRecord>();
+        cachedLeaderboardVersion = snapshotVersion;
+        rebuildLeaderboardCache();
     }
     
+    leaderboardCache.render(window);
+    
     // Кнопки
-    for (auto& button : leaderboardButtons) {
-        button.render(window);
-    }
+    buttonBatch.render(window, leaderboardButtons);
+}
+
+void Game::rebuildLeaderboardCache() {
+    Screens::buildLeaderboard(leaderboardCache, mainFont, getCanvasSize(), cachedLeaderboard);
 }
 
 void Game::renderSettings() {
-    window.draw(settingsTitle);
-    
-    for (auto& button : settingsButtons) {
-        button.render(window);
-    }
+    ProfileScope scope(profiler, "renderSettings");
     
-    sf::Text hintText("Changes apply immediately!", mainFont, 20);
-    hintText.setFillColor(sf::Color(200, 200, 200));
-    hintText.setPosition(window.getSize().x / 2 - 100, 500);
-    window.draw(hintText);
+    renderMenuLayer(settingsButtons, [this](sf::RenderTarget& target) {
+        target.draw(settingsTitle);
+        
+        for (const auto& button : settingsButtons) {
+            button.renderIdle(target);
+        }
+        
+        sf::Text hintText("Changes apply immediately!", mainFont, 20);
+        hintText.setFillColor(sf::Color(200, 200, 200));
+        hintText.setPosition(getCanvasSize().x / 2 - 100, 500);
+        target.draw(hintText);
+    });
 }
 
 void Game::renderContactForm() {
+    ProfileScope scope(profiler, "renderContactForm");
+    
     // Полупрозрачный фон
-    sf::RectangleShape overlay(sf::Vector2f(window.getSize().x, window.getSize().y));
+    sf::RectangleShape overlay(sf::Vector2f(getCanvasSize().x, getCanvasSize().y));
     overlay.setFillColor(sf::Color(0, 0, 0, 200));
     window.draw(overlay);
     
@@ -1097,29 +1331,70 @@ void Game::renderContactForm() {
 }
 
 void Game::updateBackgrounds() {
-    // Применяем яркость
-    sf::Color adjustedMenuColor(
-        std::min(255, int(menuBackgroundColor.r * brightness)),
-        std::min(255, int(menuBackgroundColor.g * brightness)),
-        std::min(255, int(menuBackgroundColor.b * brightness))
-    );
-    
-    sf::Color adjustedGameColor(
-        std::min(255, int(gameBackgroundColor.r * brightness)),
-        std::min(255, int(gameBackgroundColor.g * brightness)),
-        std::min(255, int(gameBackgroundColor.b * brightness))
+    // Фон - белая текстура 1x1, растянутая на окно. Цвет и яркость задаются
+    // цветом вершин при отрисовке, поэтому ни яркость, ни размер окна
+    // не требуют пересоздания картинок на CPU и перезаливки на GPU
+    if (menuBackgroundTexture.getSize().x == 0) {
+        sf::Image white;
+        white.create(1, 1, sf::Color::White);
+        menuBackgroundTexture.loadFromImage(white);
+        gameBackgroundTexture.loadFromImage(white);
+    }
+    
+    background.setTexture(menuBackgroundTexture, true);
+    background.setScale(static_cast<float>(getCanvasSize().x), static_cast<float>(getCanvasSize().y));
+}
+
+void Game::applyCanvasViewport(unsigned int width, unsigned int height) {
+    if (width == 0 || height == 0) return;
+    
+    // Холст масштабируется с сохранением пропорций, остаток окна - черные полосы
+    float scale = std::min(static_cast<float>(width) / CANVAS_WIDTH,
+                           static_cast<float>(height) / CANVAS_HEIGHT);
+    float viewportWidth = CANVAS_WIDTH * scale / width;
+    float viewportHeight = CANVAS_HEIGHT * scale / height;
+    sf::FloatRect viewport((1.0f - viewportWidth) / 2.0f, (1.0f - viewportHeight) / 2.0f,
+                           viewportWidth, viewportHeight);
+    
+    canvasView = sf::View(sf::FloatRect(0, 0, static_cast<float>(CANVAS_WIDTH), static_cast<float>(CANVAS_HEIGHT)));
+    canvasView.setViewport(viewport);
+    window.setView(canvasView);
+    
+    // Камера поля выводится в свою часть холста, чтобы карты не наезжали на HUD и кнопки
+    sf::FloatRect area = getBoardArea();
+    boardView.setViewport(sf::FloatRect(viewport.left + area.left / CANVAS_WIDTH * viewport.width,
+                                        viewport.top + area.top / CANVAS_HEIGHT * viewport.height,
+                                        area.width / CANVAS_WIDTH * viewport.width,
+                                        area.height / CANVAS_HEIGHT * viewport.height));
+    markDirty();
+}
+
+sf::Vector2u Game::getCanvasSize() const {
+    return sf::Vector2u(CANVAS_WIDTH, CANVAS_HEIGHT);
+}
+
+sf::FloatRect Game::getBoardArea() const {
+    // Симметрично относительно центра холста, где раскладка центрирует поле,
+    // поэтому без масштаба карты стоят там же, где и на холсте
+    return sf::FloatRect(310.0f, 145.0f, 580.0f, 610.0f);
+}
+
+sf::Vector2u Game::getCanvasPixelSize() const {
+    sf::IntRect area = window.getViewport(canvasView);
+    return sf::Vector2u(static_cast<unsigned int>(std::max(area.width, 1)),
+                        static_cast<unsigned int>(std::max(area.height, 1)));
+}
+
+sf::Vector2f Game::getCanvasMousePosition() const {
+    return window.mapPixelToCoords(sf::Mouse::getPosition(window), canvasView);
+}
+
+sf::Color Game::applyBrightness(const sf::Color& color) const {
+    return sf::Color(
+        std::min(255, int(color.r * brightness)),
+        std::min(255, int(color.g * brightness)),
+        std::min(255, int(color.b * brightness))
     );
-    
-    // Создаем текстуры
-    sf::Image menuImage;
-    menuImage.create(window.getSize().x, window.getSize().y, adjustedMenuColor);
-    menuBackgroundTexture.loadFromImage(menuImage);
-    
-    sf::Image gameImage;
-    gameImage.create(window.getSize().x, window.getSize().y, adjustedGameColor);
-    gameBackgroundTexture.loadFromImage(gameImage);
-    
-    background.setTexture(menuBackgroundTexture);
 }
 
 void Game::loadResources() {
@@ -1133,18 +1408,26 @@ void Game::loadResources() {
         "./arial.ttf"
     };
     
-    bool fontLoaded = false;
-    for (const auto& path : fontPaths) {
-        if (mainFont.loadFromFile(path)) {
-            fontLoaded = true;
-            std::cout << "Шрифт загружен: " << path << std::endl;
-            break;
-        }
+    FontManager& fonts = FontManager::getInstance();
+    if (!fonts.load("main", fontPaths)) {
+        throw std::runtime_error("Cannot load any font!");
     }
+    LOG_INFO("game", "Шрифт загружен: " << fonts.getPath("main"));
     
-    if (!fontLoaded) {
-        throw std::runtime_error("Cannot load any font!");
+    // Размеры первого экрана (вход) растеризуем сразу, остальные - в простое
+    fonts.warmUp(mainFont, 72, true);
+    fonts.warmUp(mainFont, 36);
+    fonts.warmUp(mainFont, 28);
+    fonts.warmUp(mainFont, 24);
+    fonts.warmUp(mainFont, 20);
+    fonts.warmUp(mainFont, 18);
+    for (unsigned int size : {14u, 16u, 22u, 30u, 32u, 48u, 64u, 72u}) {
+        fonts.queueWarmUp(mainFont, size);
     }
+    fonts.queueWarmUp(mainFont, 72, true, 2.0f);  // Заголовок главного меню с обводкой
+    fonts.queueWarmUp(mainFont, 64, true);
+    fonts.queueWarmUp(mainFont, 48, true);
+    fonts.queueWarmUp(mainFont, 36, true);
     
     // Инициализируем цвета фона
     menuBackgroundColor = sf::Color(30, 30, 60);
@@ -1153,18 +1436,7 @@ void Game::loadResources() {
     updateBackgrounds();
     
     // Настройка текстовых элементов
-    titleText.setFont(mainFont);
-    titleText.setString("Memory Game");
-    titleText.setCharacterSize(72);
-    titleText.setFillColor(sf::Color::White);
-    titleText.setStyle(sf::Text::Bold);
-    titleText.setOutlineColor(sf::Color::Black);
-    titleText.setOutlineThickness(2);
-    
-    sf::FloatRect titleBounds = titleText.getLocalBounds();
-    titleText.setOrigin(titleBounds.left + titleBounds.width / 2.0f,
-                        titleBounds.top + titleBounds.height / 2.0f);
-    titleText.setPosition(600, 100);
+    Screens::setupTitle(titleText, mainFont);
     
     statsText.setFont(mainFont);
     statsText.setCharacterSize(20); 
@@ -1202,249 +1474,77 @@ void Game::loadResources() {
     nameInputBox.setFillColor(sf::Color(50, 50, 50));
     nameInputBox.setOutlineThickness(2);
     nameInputBox.setOutlineColor(sf::Color::White);
+    
+    profilerText.setFont(mainFont);
+    profilerText.setCharacterSize(14);
+    profilerText.setFillColor(sf::Color(0, 255, 0));
+    profilerText.setPosition(10, 10);
+    
+    profilerBackground.setFillColor(sf::Color(0, 0, 0, 180));
 }
 
 void Game::setupAchievementsUI() {
-    achievementsButtons.clear();
-    
-    float buttonWidth = 200.0f;
-    float buttonHeight = 50.0f;
-    float centerX = window.getSize().x / 2 - buttonWidth / 2;
-    float buttonY = window.getSize().y - 100;
-    
-    achievementsButtons.emplace_back(centerX, buttonY, buttonWidth, buttonHeight, "Back to Menu", mainFont, 
-                                   [this]() { 
+    Screens::setupBackButton(achievementsButtons, mainFont, getCanvasSize(), [this]() {
         currentState = GameState::MAIN_MENU;
     });
-    
-    achievementsButtons[0].setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
 }
 
 void Game::renderAchievements() {
-    // Заголовок
-    sf::Text title("Achievements", mainFont, 64);
-    title.setFillColor(sf::Color::White);
-    title.setStyle(sf::Text::Bold);
-    title.setPosition(window.getSize().x / 2 - 150, 50);
-    window.draw(title);
+    ProfileScope scope(profiler, "renderAchievements");
     
-    if (!achievementManager) {
-        // Если менеджер достижений не создан
-        sf::Text noAchievements("Achievements system not initialized", mainFont, 32);
-        noAchievements.setFillColor(sf::Color::Red);
-        noAchievements.setPosition(window.getSize().x / 2 - 200, 200);
-        window.draw(noAchievements);
-        
-        // Кнопки
-        for (auto& button : achievementsButtons) {
-            button.render(window);
-        }
-        return;
+    // Список пересобирается при входе на экран и при прокрутке
+    if (!achievementsCache.isValid()) {
+        rebuildAchievementsCache();
     }
     
-    // Статистика достижений
-    int unlockedCount = achievementManager->getUnlockedCount();
-    int totalCount = achievementManager->getTotalCount();
-    int totalScore = achievementManager->getTotalScore();
+    achievementsCache.render(window);
+    
+    // Кнопка назад
+    buttonBatch.render(window, achievementsButtons);
+}
+
+void Game::rebuildAchievementsCache() {
+    Screens::AchievementsView view;
+    std::vector<Achievement> allAchievements;
+    
+    if (achievementManager) {
+        allAchievements = achievementManager->getAllAchievements();
+        view.achievements = &allAchievements;
+        view.unlockedCount = achievementManager->getUnlockedCount();
+        view.totalCount = achievementManager->getTotalCount();
+        view.totalScore = achievementManager->getTotalScore();
+    }
     
     // Заголовок с именем игрока
-    std::string playerHeader = "Player: ";
     if (player) {
-        playerHeader += player->getName();
+        view.playerName = player->getName();
     } else if (userManager && userManager->isUserLoggedIn()) {
-        playerHeader += userManager->getCurrentUsername();
+        view.playerName = userManager->getCurrentUsername();
     } else {
-        playerHeader += "Guest";
+        view.playerName = "Guest";
     }
+    view.scrollOffset = achievementsScrollOffset;
     
-    sf::Text playerText(playerHeader, mainFont, 28);
-    playerText.setFillColor(sf::Color::Yellow);
-    playerText.setPosition(50, 120);
-    window.draw(playerText);
-    
-    // Статистика
-    std::stringstream stats;
-    stats << "Progress: " << unlockedCount << "/" << totalCount << " (" 
-          << std::fixed << std::setprecision(1) 
-          << (totalCount > 0 ? (float)unlockedCount / totalCount * 100 : 0) << "%)\n"
-          << "Total Score: " << totalScore << "\n"
-          << "Unlocked Achievements:";
-    
-    sf::Text statsText(stats.str(), mainFont, 24);
-    statsText.setFillColor(sf::Color::Yellow);
-    statsText.setPosition(50, 160);
-    window.draw(statsText);
-    
-    // Список достижений
-    auto allAchievements = achievementManager->getAllAchievements();
-    float startY = 250.0f;
-    float spacing = 70.0f;
-    float panelWidth = 700.0f;
-    float panelHeight = 60.0f;
-    
-    // Создаем область для скроллинга
-    sf::RectangleShape scrollArea(sf::Vector2f(800, 400));
-    scrollArea.setPosition(40, 240);
-    scrollArea.setFillColor(sf::Color(0, 0, 0, 0)); // Прозрачная
-    scrollArea.setOutlineColor(sf::Color(100, 100, 100));
-    scrollArea.setOutlineThickness(1);
-    window.draw(scrollArea);
-    
-    // Применяем смещение скроллинга
-    float renderStartY = startY - achievementsScrollOffset;
-    
-    // Проверяем, есть ли достижения
-    if (allAchievements.empty()) {
-        sf::Text noData("No achievements data available", mainFont, 28);
-        noData.setFillColor(sf::Color(200, 200, 200));
-        noData.setPosition(window.getSize().x / 2 - 150, renderStartY);
-        window.draw(noData);
-    } else {
-        // Прокручиваемый список достижений
-        for (size_t i = 0; i < allAchievements.size(); i++) {
-            const auto& achievement = allAchievements[i];
-            
-            float achievementY = renderStartY + i * spacing;
-            
-            // Пропускаем элементы, которые вне области видимости
-            if (achievementY < 240 || achievementY > 640) {
-                continue;
-            }
-            
-            // Фон для достижения
-            sf::RectangleShape achievementBg(sf::Vector2f(panelWidth, panelHeight));
-            achievementBg.setPosition(50, achievementY);
-            
-            if (achievement.unlocked) {
-                achievementBg.setFillColor(sf::Color(60, 60, 60, 200));
-                achievementBg.setOutlineColor(sf::Color::Green);
-            } else {
-                achievementBg.setFillColor(sf::Color(40, 40, 40, 200));
-                achievementBg.setOutlineColor(sf::Color(100, 100, 100));
-            }
-            
-            achievementBg.setOutlineThickness(2);
-            window.draw(achievementBg);
-            
-            // Иконка
-            if (!achievement.icon.empty()) {
-                sf::Text iconText(achievement.icon, mainFont, 30);
-                iconText.setPosition(60, achievementY + 15);
-                
-                if (achievement.unlocked) {
-                    iconText.setFillColor(achievement.getRarityColor());
-                } else {
-                    iconText.setFillColor(sf::Color(100, 100, 100));
-                }
-                window.draw(iconText);
-            }
-            
-            // Название и описание
-            std::string titleStr = achievement.title;
-            if (achievement.unlocked) {
-                titleStr = "✓ " + titleStr;
-            }
-            
-            sf::Text titleText(titleStr, mainFont, 22);
-            if (achievement.unlocked) {
-                titleText.setFillColor(sf::Color::White);
-            } else {
-                titleText.setFillColor(sf::Color(150, 150, 150));
-            }
-            titleText.setPosition(100, achievementY + 5);
-            window.draw(titleText);
-            
-            sf::Text descText(achievement.description, mainFont, 16);
-            if (achievement.unlocked) {
-                descText.setFillColor(sf::Color(200, 200, 200));
-            } else {
-                descText.setFillColor(sf::Color(100, 100, 100));
-            }
-            descText.setPosition(100, achievementY + 32);
-            window.draw(descText);
-            
-            // Прогресс (только если не разблокировано)
-            if (!achievement.unlocked && achievement.requirement > 1) {
-                std::string progressStr = std::to_string(achievement.progress) + 
-                                         "/" + std::to_string(achievement.requirement);
-                sf::Text progressText(progressStr, mainFont, 18);
-                progressText.setFillColor(sf::Color::Yellow);
-                progressText.setPosition(600, achievementY + 15);
-                window.draw(progressText);
-                
-                // Прогресс-бар
-                sf::RectangleShape progressBg(sf::Vector2f(100, 10));
-                progressBg.setPosition(650, achievementY + 20);
-                progressBg.setFillColor(sf::Color(50, 50, 50));
-                window.draw(progressBg);
-                
-                float progressWidth = (float)achievement.progress / achievement.requirement * 100.0f;
-                if (progressWidth > 100) progressWidth = 100;
-                
-                sf::RectangleShape progressBar(sf::Vector2f(progressWidth, 10));
-                progressBar.setPosition(650, achievementY + 20);
-                progressBar.setFillColor(achievement.getRarityColor());
-                window.draw(progressBar);
-            } else if (achievement.unlocked) {
-                // Для разблокированных - показываем дату или иконку разблокировки
-                sf::Text unlockedText("UNLOCKED", mainFont, 16);
-                unlockedText.setFillColor(sf::Color::Green);
-                unlockedText.setPosition(650, achievementY + 20);
-                window.draw(unlockedText);
-            }
-            
-            // Редкость
-            sf::Text rarityText(achievement.getRarityString(), mainFont, 14);
-            rarityText.setFillColor(achievement.getRarityColor());
-            rarityText.setPosition(750, achievementY + 20);
-            window.draw(rarityText);
-        }
-    }
-    
-    // Полоса прокрутки
-    float totalContentHeight = allAchievements.size() * spacing;
-    float visibleHeight = 400;
-    
-    if (totalContentHeight > visibleHeight) {
-        // Рисуем полосу прокрутки
-        sf::RectangleShape scrollTrack(sf::Vector2f(10, visibleHeight));
-        scrollTrack.setPosition(770, 240);
-        scrollTrack.setFillColor(sf::Color(50, 50, 50));
-        window.draw(scrollTrack);
-        
-        // Бегунок
-        float thumbHeight = (visibleHeight / totalContentHeight) * visibleHeight;
-        float thumbPosition = (achievementsScrollOffset / (totalContentHeight - visibleHeight)) * (visibleHeight - thumbHeight);
-        
-        sf::RectangleShape scrollThumb(sf::Vector2f(10, thumbHeight));
-        scrollThumb.setPosition(770, 240 + thumbPosition);
-        scrollThumb.setFillColor(sf::Color(150, 150, 150));
-        window.draw(scrollThumb);
-    }
-    
-    // Кнопка назад
-    for (auto& button : achievementsButtons) {
-        button.render(window);
-    }
+    Screens::buildAchievements(achievementsCache, mainFont, getCanvasSize(), view);
 }
 
 void Game::checkAchievements() {
     if (!achievementManager) {
-        std::cout << "❌ Cannot check achievements: achievement manager not initialized" << std::endl;
+        LOG_WARNING("game", "❌ Cannot check achievements: achievement manager not initialized");
         return;
     }
     
     if (!player) {
-        std::cout << "❌ Cannot check achievements: player not initialized" << std::endl;
+        LOG_WARNING("game", "❌ Cannot check achievements: player not initialized");
         return;
     }
     
-    std::cout << "=== CHECKING ACHIEVEMENTS ===" << std::endl;
-    std::cout << "Player: " << player->getName() << std::endl;
-    std::cout << "Score: " << player->getScore() << std::endl;
-    std::cout << "Moves: " << moves << std::endl;
-    std::cout << "Total pairs: " << totalPairs << std::endl;
-    std::cout << "Time: " << elapsedTime.asSeconds() << " seconds" << std::endl;
+    LOG_DEBUG("game", "=== CHECKING ACHIEVEMENTS ===");
+    LOG_DEBUG("game", "Player: " << player->getName());
+    LOG_DEBUG("game", "Score: " << player->getScore());
+    LOG_DEBUG("game", "Moves: " << moves);
+    LOG_DEBUG("game", "Total pairs: " << totalPairs);
+    LOG_DEBUG("game", "Time: " << elapsedTime.asSeconds() << " seconds");
     
     achievementManager->recordDailyPlay();
     
@@ -1479,13 +1579,13 @@ void Game::checkAchievements() {
     
     // Проверяем быстрый подбор пары
     if (pairTimer.getElapsedTime().asSeconds() < 3.0) {
-        std::cout << "Quick match detected: " << pairTimer.getElapsedTime().asSeconds() << " seconds" << std::endl;
+        LOG_DEBUG("game", "Quick match detected: " << pairTimer.getElapsedTime().asSeconds() << " seconds");
         achievementManager->recordQuickMatch(pairTimer.getElapsedTime().asSeconds());
     }
     
     // Проверяем достижение "Perfect Game" (все пары найдены за минимальное количество ходов)
     if (moves == totalPairs) {
-        std::cout << "Perfect game detected! Moves = Pairs" << std::endl;
+        LOG_DEBUG("game", "Perfect game detected! Moves = Pairs");
         achievementManager->updateAchievement(AchievementType::PERFECT_GAME);
     }
     
@@ -1496,14 +1596,14 @@ void Game::checkAchievements() {
     
     // Проверяем достижение "Speed Runner" (менее 60 секунд)
     if (elapsedTime.asSeconds() < 60.0) {
-        std::cout << "Speed run detected: " << elapsedTime.asSeconds() << " seconds" << std::endl;
+        LOG_DEBUG("game", "Speed run detected: " << elapsedTime.asSeconds() << " seconds");
         achievementManager->updateAchievement(AchievementType::SPEED_RUNNER);
     }
     
     // Проверяем достижение "Moves Efficient" (100% эффективность)
     float efficiency = (float)matchedPairs / (moves > 0 ? moves : 1);
     if (efficiency >= 1.0f) {
-        std::cout << "100% efficiency detected: " << efficiency << std::endl;
+        LOG_DEBUG("game", "100% efficiency detected: " << efficiency);
         achievementManager->updateAchievement(AchievementType::MOVES_EFFICIENT);
     }
     
@@ -1515,55 +1615,21 @@ void Game::checkAchievements() {
         achievementsPath = "achievements_" + player->getName() + ".dat";
     }
     
-    std::cout << "💾 Saving achievements to: " << achievementsPath << std::endl;
+    LOG_INFO("game", "💾 Saving achievements to: " << achievementsPath);
     achievementManager->saveToFile(achievementsPath);
     
     // Проверяем, что что-то сохранилось
     auto unlockedCount = achievementManager->getUnlockedCount();
-    std::cout << "✅ Achievements checked. Unlocked: " << unlockedCount << std::endl;
+    LOG_INFO("game", "✅ Achievements checked. Unlocked: " << unlockedCount);
 }
 
 void Game::setupMainMenu() {
-    mainMenuButtons.clear();
-    
-    float buttonWidth = 300.0f;
-    float buttonHeight = 60.0f;
-    float startY = 300.0f;
-    float spacing = 80.0f;
-    
-    mainMenuButtons.emplace_back(
-        450.0f, startY, buttonWidth, buttonHeight, 
-        "New Game", mainFont, 
-        [this]() { startNewGame(); }
-    );
-    
-    mainMenuButtons.emplace_back(
-        450.0f, startY + spacing, buttonWidth, buttonHeight, 
-        "Leaderboard", mainFont, 
-        [this]() { showLeaderboard(); }
-    );
-    
-    mainMenuButtons.emplace_back(
-        450.0f, startY + spacing * 2, buttonWidth, buttonHeight, 
-        "Achievements", mainFont,
-        [this]() { showAchievements(); }
-    );
-    
-    mainMenuButtons.emplace_back(
-        450.0f, startY + spacing * 3, buttonWidth, buttonHeight, 
-        "Settings", mainFont, 
-        [this]() { showSettings(); }
-    );
-    
-    mainMenuButtons.emplace_back(
-        450.0f, startY + spacing * 4, buttonWidth, buttonHeight, 
-        "Exit", mainFont, 
-        [this]() { exitGame(); }
-    );
-    
-    for (auto& button : mainMenuButtons) {
-        button.setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
-    }
+    Screens::setupMainMenuButtons(mainMenuButtons, mainFont,
+        [this]() { startNewGame(); },
+        [this]() { showLeaderboard(); },
+        [this]() { showAchievements(); },
+        [this]() { showSettings(); },
+        [this]() { exitGame(); });
 }
 
 void Game::setupGameUI() {
@@ -1573,13 +1639,13 @@ void Game::setupGameUI() {
     float buttonHeight = 40.0f;
     
     gameButtons.emplace_back(
-        window.getSize().x - 200, 50.0f, buttonWidth, buttonHeight,
+        getCanvasSize().x - 200, 50.0f, buttonWidth, buttonHeight,
         "Pause", mainFont,
         [this]() { pauseGame(); }
     );
     
     gameButtons.emplace_back(
-        window.getSize().x - 200, 100.0f, buttonWidth, buttonHeight,
+        getCanvasSize().x - 200, 100.0f, buttonWidth, buttonHeight,
         "Menu", mainFont,
         [this]() { 
             currentState = GameState::MAIN_MENU;
@@ -1588,7 +1654,7 @@ void Game::setupGameUI() {
     );
     
     gameButtons.emplace_back(
-        window.getSize().x - 200, 150.0f, buttonWidth, buttonHeight,
+        getCanvasSize().x - 200, 150.0f, buttonWidth, buttonHeight,
         "Restart", mainFont,
         [this]() { startNewGame(); }
     );
@@ -1602,7 +1668,7 @@ void Game::setupGameUI() {
     }
     
     // Обновляем позицию кнопки сдачи
-    surrenderButton.setPosition(window.getSize().x - 250, window.getSize().y - 100);
+    surrenderButton.setPosition(getCanvasSize().x - 250, getCanvasSize().y - 100);
 }
 
 void Game::setupPauseMenu() {
@@ -1610,7 +1676,7 @@ void Game::setupPauseMenu() {
     
     float buttonWidth = 250.0f;
     float buttonHeight = 60.0f;
-    float centerX = window.getSize().x / 2 - buttonWidth / 2;
+    float centerX = getCanvasSize().x / 2 - buttonWidth / 2;
     float startY = 350.0f;
     float spacing = 80.0f;
     
@@ -1655,6 +1721,11 @@ void Game::setupSetupMenu() {
                 setupButtons[0].setText("Difficulty: Expert"); 
                 break;
             case Difficulty::EXPERT: 
+                setDifficulty(Difficulty::CUSTOM); 
+                setupButtons[0].setText("Difficulty: Custom " + std::to_string(customRows) +
+                                        "x" + std::to_string(customCols)); 
+                break;
+            case Difficulty::CUSTOM: 
                 setDifficulty(Difficulty::EASY); 
                 setupButtons[0].setText("Difficulty: Easy"); 
                 break;
@@ -1696,8 +1767,7 @@ void Game::setupSetupMenu() {
             currentState = GameState::PLAYING;
             background.setTexture(gameBackgroundTexture);
             isGameActive = true;
-            gameClock.restart();
-            std::cout << "Игра начата! Всего пар: " << totalPairs << std::endl;
+            LOG_INFO("game", "Игра начата! Всего пар: " << totalPairs);
         }
     });
     
@@ -1710,7 +1780,7 @@ void Game::setupSetupMenu() {
         sf::FloatRect titleBounds = titleText.getLocalBounds();
         titleText.setOrigin(titleBounds.left + titleBounds.width / 2.0f,
                            titleBounds.top + titleBounds.height / 2.0f);
-        titleText.setPosition(window.getSize().x / 2, 100);
+        titleText.setPosition(getCanvasSize().x / 2, 100);
     });
     
     // Цвета
@@ -1722,19 +1792,9 @@ void Game::setupSetupMenu() {
 }
 
 void Game::setupLeaderboardUI() {
-    leaderboardButtons.clear();
-    
-    float buttonWidth = 200.0f;
-    float buttonHeight = 50.0f;
-    float centerX = window.getSize().x / 2 - buttonWidth / 2;
-    float buttonY = window.getSize().y - 100;
-    
-    leaderboardButtons.emplace_back(centerX, buttonY, buttonWidth, buttonHeight, "Back to Menu", mainFont, 
-                                   [this]() { 
+    Screens::setupBackButton(leaderboardButtons, mainFont, getCanvasSize(), [this]() {
         currentState = GameState::MAIN_MENU;
     });
-    
-    leaderboardButtons[0].setColors(sf::Color(70, 130, 180), sf::Color(100, 149, 237), sf::Color(30, 144, 255));
 }
 
 void Game::setupSettingsMenu() {
@@ -1758,7 +1818,8 @@ void Game::setupSettingsMenu() {
             ss << "Brightness: " << int(brightness * 100) << "%";
             settingsButtons[0].setText(ss.str());
             
-            updateBackgrounds();
+            // Новая яркость применится цветом фона в следующем кадре
+            markDirty();
         }
     );
     
@@ -1774,11 +1835,10 @@ void Game::setupSettingsMenu() {
             ss << "Resolution: " << currentVideoMode.width << "x" << currentVideoMode.height;
             settingsButtons[1].setText(ss.str());
             
-            window.create(currentVideoMode, "Memory Game", 
-                         sf::Style::Titlebar | sf::Style::Close | sf::Style::Resize);
-            window.setFramerateLimit(60);
-            
-            updateBackgrounds();
+            // Окно и GL-контекст остаются прежними: текстуры и раскладка не трогаются,
+            // меняется только область вывода холста
+            window.setSize(sf::Vector2u(currentVideoMode.width, currentVideoMode.height));
+            applyCanvasViewport(currentVideoMode.width, currentVideoMode.height);
         }
     );
     
@@ -1811,45 +1871,33 @@ void Game::setupSettingsMenu() {
 }
 
 void Game::setupContactForm() {
-    std::cout << "Настройка формы обратной связи..." << std::endl;
+    LOG_INFO("game", "Настройка формы обратной связи...");
     
-    // Пытаемся загрузить шрифт для формы
-    std::vector<std::string> fontPaths = {
-        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
-        "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
-        "/usr/share/fonts/truetype/ubuntu/Ubuntu-R.ttf"
-    };
-    
-    for (const auto& path : fontPaths) {
-        if (contactForm.loadFont(path)) {
-            std::cout << "Шрифт для формы загружен: " << path << std::endl;
-            break;
-        }
-    }
+    // Форма использует общий шрифт, а не загружает свою копию
+    contactForm.setFont(mainFont);
     
     // Настраиваем форму
-    contactForm.setup(window.getSize().x, window.getSize().y);
+    contactForm.setup(getCanvasSize().x, getCanvasSize().y);
 }
 
-void Game::initializeCards() {
-    gameCards.clear();
-    
-    // Устанавливаем размеры
-    switch (difficulty) {
-        case Difficulty::EASY: rows = 3; cols = 4; totalPairs = 6; break;
-        case Difficulty::MEDIUM: rows = 4; cols = 4; totalPairs = 8; break;
-        case Difficulty::HARD: rows = 4; cols = 6; totalPairs = 12; break;
-        case Difficulty::EXPERT: rows = 6; cols = 6; totalPairs = 18; break;
+void Game::getBoardSize(Difficulty diff, int& boardRows, int& boardCols) const {
+    switch (diff) {
+        case Difficulty::EASY: boardRows = 3; boardCols = 4; break;
+        case Difficulty::MEDIUM: boardRows = 4; boardCols = 4; break;
+        case Difficulty::HARD: boardRows = 4; boardCols = 6; break;
+        case Difficulty::EXPERT: boardRows = 6; boardCols = 6; break;
+        case Difficulty::CUSTOM:
+            boardRows = customRows;
+            boardCols = customCols;
+            // Нечетное число карт не разбить на пары - добавляем столбец
+            if ((boardRows * boardCols) % 2 != 0) boardCols++;
+            break;
     }
-    
-    int totalCards = rows * cols;
-    std::cout << "\n=== ИНИЦИАЛИЗАЦИЯ КАРТ ===" << std::endl;
-    std::cout << "Поле: " << rows << "x" << cols << " = " << totalCards << " карт" << std::endl;
-    std::cout << "Нужно пар: " << totalPairs << std::endl;
-    
-    // Получаем файлы из папки текущей темы
+}
+
+std::string Game::getThemeImageDir(CardTheme theme) const {
     std::string themeFolder;
-    switch (currentTheme) {
+    switch (theme) {
         case CardTheme::ANIMALS: themeFolder = "animals"; break;
         case CardTheme::FRUITS: themeFolder = "fruits"; break;
         case CardTheme::EMOJI: themeFolder = "emoji"; break;
@@ -1857,31 +1905,32 @@ void Game::initializeCards() {
         case CardTheme::SYMBOLS: themeFolder = "symbols"; break;
         default: themeFolder = "animals"; break;
     }
+    return "assets/images/" + themeFolder + "/";
+}
+
+void Game::initializeCards() {
+    gameCards.clear();
+    
+    // Устанавливаем размеры
+    getBoardSize(difficulty, rows, cols);
+    totalPairs = rows * cols / 2;
     
-    std::string imageDir = "assets/images/" + themeFolder + "/";
-    std::cout << "Ищем изображения в: " << imageDir << std::endl;
+    int totalCards = rows * cols;
+    LOG_DEBUG("game", "=== ИНИЦИАЛИЗАЦИЯ КАРТ ===");
+    LOG_DEBUG("game", "Поле: " << rows << "x" << cols << " = " << totalCards << " карт");
+    LOG_DEBUG("game", "Нужно пар: " << totalPairs);
+    
+    // Получаем файлы из папки текущей темы
+    std::string imageDir = getThemeImageDir(currentTheme);
+    LOG_DEBUG("game", "Ищем изображения в: " << imageDir);
     
     // Собираем список доступных файлов
-    std::vector<std::string> availableImages;
-    try {
-        for (const auto& entry : fs::directory_iterator(imageDir)) {
-            if (entry.is_regular_file()) {
-                std::string ext = entry.path().extension().string();
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-                
-                if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp") {
-                    availableImages.push_back(entry.path().string());
-                    std::cout << "  Найдено: " << entry.path().filename() << std::endl;
-                }
-            }
-        }
-    } catch (const std::exception& e) {
-        std::cout << "Ошибка доступа к папке: " << e.what() << std::endl;
-    }
+    std::vector<std::string> availableImages = themeIndex.getImages(imageDir);
+    LOG_DEBUG("game", "  Найдено файлов: " << availableImages.size());
     
     // Если нет файлов, создаем тестовые имена
     if (availableImages.empty()) {
-        std::cout << "Файлы не найдены, создаем тестовые..." << std::endl;
+        LOG_DEBUG("game", "Файлы не найдены, создаем тестовые...");
         for (int i = 1; i <= totalPairs; i++) {
             availableImages.push_back(imageDir + "image" + std::to_string(i) + ".png");
         }
@@ -1901,7 +1950,7 @@ void Game::initializeCards() {
         pairedImages.push_back(availableImages[pairedImages.size() % availableImages.size()]);
     }
     
-    std::cout << "Используем " << pairedImages.size() << " изображений для пар" << std::endl;
+    LOG_DEBUG("game", "Используем " << pairedImages.size() << " изображений для пар");
     
     // создаем карты парами
     int cardId = 0;
@@ -1913,9 +1962,8 @@ void Game::initializeCards() {
         // Вторая карта пары (ТА ЖЕ САМАЯ!)
         gameCards.emplace_back(cardId++, imagePath, currentTheme);
         
-        std::string filename = fs::path(imagePath).filename().string();
-        std::cout << "  Пара #" << (i+1) << ": " << filename 
-                  << " (ID: " << (cardId-2) << " и " << (cardId-1) << ")" << std::endl;
+        LOG_DEBUG("game", "  Пара #" << (i+1) << ": " << fs::path(imagePath).filename().string()
+                  << " (ID: " << (cardId-2) << " и " << (cardId-1) << ")");
     }
     
     // Перемешиваем
@@ -1924,14 +1972,14 @@ void Game::initializeCards() {
     std::shuffle(gameCards.begin(), gameCards.end(), g);
     
     // проверка
-    std::cout << "\n📊 ПРОВЕРКА:" << std::endl;
-    std::cout << "Всего карт: " << gameCards.size() << std::endl;
-    std::cout << "Должно быть: " << totalCards << std::endl;
+    LOG_DEBUG("game", "📊 ПРОВЕРКА:");
+    LOG_DEBUG("game", "Всего карт: " << gameCards.size());
+    LOG_DEBUG("game", "Должно быть: " << totalCards);
     
     if (gameCards.size() == static_cast<size_t>(totalCards)) {
-        std::cout << "✅ Размер правильный!" << std::endl;
+        LOG_DEBUG("game", "✅ Размер правильный!");
     } else {
-        std::cout << "❌ ОШИБКА: неверное количество карт!" << std::endl;
+        LOG_WARNING("game", "❌ ОШИБКА: неверное количество карт!");
         // Корректируем
         if (gameCards.size() > static_cast<size_t>(totalCards)) {
             gameCards.resize(totalCards);
@@ -1943,10 +1991,12 @@ void Game::initializeCards() {
         }
     }
     
-    std::cout << "=== ИНИЦИАЛИЗАЦИЯ ЗАВЕРШЕНА ===\n" << std::endl;
+    LOG_DEBUG("game", "=== ИНИЦИАЛИЗАЦИЯ ЗАВЕРШЕНА ===");
 }
 
 void Game::createCardSprites() {
+    cardTweens.clear();
+    matchParticles.clear();
     cards.clear();
     
     // Размеры карточек
@@ -1956,19 +2006,42 @@ void Game::createCardSprites() {
     // Центрируем игровое поле
     float totalWidth = cols * cardSize + (cols - 1) * spacing;
     float totalHeight = rows * cardSize + (rows - 1) * spacing;
-    float startX = (window.getSize().x - totalWidth) / 2;
-    float startY = (window.getSize().y - totalHeight) / 2 + 50;
+    float startX = (getCanvasSize().x - totalWidth) / 2;
+    float startY = (getCanvasSize().y - totalHeight) / 2 + 50;
+    
+    boardLayout.configure(rows, cols, cardSize, spacing, sf::Vector2f(startX, startY));
+    setupBoardView();
+    BoardLayout::Range initialRange = getVisibleBoardRange();
     
-    std::cout << "\n=== СОЗДАНИЕ СПРАЙТОВ КАРТ ===" << std::endl;
-    std::cout << "Создание " << (rows * cols) << " спрайтов..." << std::endl;
+    LOG_DEBUG("game", "=== СОЗДАНИЕ СПРАЙТОВ КАРТ ===");
+    LOG_DEBUG("game", "Создание " << (rows * cols) << " спрайтов...");
+    
+    // Все картинки темы декодируем один раз и заливаем в общий атлас одной пачкой
+    std::vector<std::string> imagePaths;
+    for (int i = 0; i < rows * cols && i < static_cast<int>(gameCards.size()); i++) {
+        imagePaths.push_back(gameCards[i].getSymbol());
+    }
+    TextureAtlas& atlas = TextureAtlas::getInstance();
+    atlas.preload(imagePaths);
+    
+    // Запасные символы для незагрузившихся картинок растеризуем той же пачкой
+    std::vector<std::string> fallbackSymbols;
+    sf::IntRect region;
+    for (size_t i = 0; i < imagePaths.size(); i++) {
+        if (!atlas.findRegion(imagePaths[i], region)) {
+            fallbackSymbols.push_back("IMG" + std::to_string((i % totalPairs) + 1));
+        }
+    }
+    if (!fallbackSymbols.empty()) {
+        SymbolAtlas::getInstance().preload(fallbackSymbols, mainFont,
+                                           static_cast<unsigned int>(cardSize * 0.4f));
+    }
     
     // Создаем спрайты карточек
     for (int i = 0; i < rows * cols && i < static_cast<int>(gameCards.size()); i++) {
-        int row = i / cols;
-        int col = i % cols;
-        
-        float x = startX + col * (cardSize + spacing);
-        float y = startY + row * (cardSize + spacing);
+        sf::Vector2f position = boardLayout.getCardPosition(i);
+        float x = position.x;
+        float y = position.y;
         
         const Card& cardData = gameCards[i];
         std::string imagePath = cardData.getSymbol();
@@ -1979,7 +2052,7 @@ void Game::createCardSprites() {
         
         // Пытаемся загрузить изображение
         if (!cardSprite->loadImage(imagePath)) {
-            std::cout << "⚠ Не удалось загрузить изображение: " << imagePath << std::endl;
+            LOG_WARNING("game", "⚠ Не удалось загрузить изображение: " << imagePath);
             // Если не удалось загрузить, используем текстовый символ
             std::string fallback = "IMG" + std::to_string((i % totalPairs) + 1);
             cardSprite->setSymbol(fallback, mainFont);
@@ -1988,18 +2061,29 @@ void Game::createCardSprites() {
         cardSprite->setClickable(true);
         cardSprite->hide();
         
+        // Видимые карты появляются волной, остальные анимировать незачем
+        int row = i / cols;
+        int col = i % cols;
+        if (row >= initialRange.firstRow && row < initialRange.endRow &&
+            col >= initialRange.firstCol && col < initialRange.endCol) {
+            float delay = std::min(i * 0.015f, 0.5f);
+            cardTweens.start(cardSprite.get(), TweenSystem::Property::Fade, 0.25f, delay);
+        }
+        
         cards.push_back(std::move(cardSprite));
     }
     
-    std::cout << "✅ Создано " << cards.size() << " спрайтов карт" << std::endl;
+    boardRenderer.invalidate();
+    LOG_DEBUG("game", "✅ Создано " << cards.size() << " спрайтов карт");
 }
 
 void Game::resetGame() {
-    std::cout << "\n=== СБРОС ИГРЫ ===" << std::endl;
+    LOG_DEBUG("game", "=== СБРОС ИГРЫ ===");
     
     // Сбрасываем состояние игры
     matchedPairs = 0;
     moves = 0;
+    hudModel.invalidate();
     isGameActive = false;
     firstCardSelected = false;
     selectedCard1 = -1;
@@ -2010,41 +2094,46 @@ void Game::resetGame() {
     isFlipping = false;
     cardFlipProgress = 0.0f;
     hasWon = false;
+    
+    // Отменяем отложенные действия прошлой партии
+    scheduler.clear();
+    queuedCardClicks.clear();
     consecutiveMatches = 0; // Сбрасываем счетчик последовательных совпадений
     
-    std::cout << "matchedPairs сброшен на 0" << std::endl;
-    std::cout << "hasWon сброшен на false" << std::endl;
-    std::cout << "consecutiveMatches сброшен на 0" << std::endl;
+    LOG_DEBUG("game", "matchedPairs сброшен на 0");
+    LOG_DEBUG("game", "hasWon сброшен на false");
+    LOG_DEBUG("game", "consecutiveMatches сброшен на 0");
     
-    // Очищаем существующие карты
+    // Очищаем существующие карты (твины держат указатели на них)
+    cardTweens.clear();
     cards.clear();
     gameCards.clear();
     
-    std::cout << "Сбрасываем игрока..." << std::endl;
+    LOG_DEBUG("game", "Сбрасываем игрока...");
     if (player) {
         player->startGame();
     }
     
-    std::cout << "Инициализируем новые карты..." << std::endl;
+    LOG_DEBUG("game", "Инициализируем новые карты...");
     initializeCards();
     
-    std::cout << "Создаем спрайты карт..." << std::endl;
+    LOG_DEBUG("game", "Создаем спрайты карт...");
     createCardSprites();
     
     // Проверяем результат
-    std::cout << "Результат инициализации:" << std::endl;
-    std::cout << "  Размер поля: " << rows << "x" << cols << " = " << (rows * cols) << " карт" << std::endl;
-    std::cout << "  Создано спрайтов: " << cards.size() << std::endl;
-    std::cout << "  Всего пар: " << totalPairs << std::endl;
+    LOG_DEBUG("game", "Результат инициализации:");
+    LOG_DEBUG("game", "  Размер поля: " << rows << "x" << cols << " = " << (rows * cols) << " карт");
+    LOG_DEBUG("game", "  Создано спрайтов: " << cards.size());
+    LOG_DEBUG("game", "  Всего пар: " << totalPairs);
     
     if (cards.size() == static_cast<size_t>(rows * cols)) {
-        std::cout << "✅ Инициализация успешна!" << std::endl;
+        LOG_DEBUG("game", "✅ Инициализация успешна!");
     } else {
-        std::cout << "❌ ОШИБКА: Не все спрайты созданы!" << std::endl;
+        LOG_WARNING("game", "❌ ОШИБКА: Не все спрайты созданы!");
         int neededCards = rows * cols;
         int currentCards = cards.size();
         if (currentCards < neededCards) {
-            std::cout << "  Создаем недостающие " << (neededCards - currentCards) << " карт..." << std::endl;
+            LOG_DEBUG("game", "  Создаем недостающие " << (neededCards - currentCards) << " карт...");
             
             // Получаем пути к изображениям для текущей темы
             std::vector<std::string> imagePaths;
@@ -2054,8 +2143,8 @@ void Game::resetGame() {
             float spacing = 10.0f;
             float totalWidth = cols * cardSize + (cols - 1) * spacing;
             float totalHeight = rows * cardSize + (rows - 1) * spacing;
-            float startX = (window.getSize().x - totalWidth) / 2;
-            float startY = (window.getSize().y - totalHeight) / 2 + 50;
+            float startX = (getCanvasSize().x - totalWidth) / 2;
+            float startY = (getCanvasSize().y - totalHeight) / 2 + 50;
             
             for (int i = currentCards; i < neededCards; i++) {
                 int row = i / cols;
@@ -2083,40 +2172,163 @@ void Game::resetGame() {
                 cards.push_back(std::move(cardSprite));
             }
             
-            std::cout << "  ✅ Досоздано " << (neededCards - currentCards) << " карт" << std::endl;
+            LOG_DEBUG("game", "  ✅ Досоздано " << (neededCards - currentCards) << " карт");
         }
     }
     
     // Сбрасываем таймер
-    gameClock.restart();
     elapsedTime = sf::Time::Zero;
     
     // Сбрасываем таймер быстрых совпадений
     pairTimer.restart();
     
-    std::cout << "=== СБРОС ЗАВЕРШЕН ===\n" << std::endl;
+    LOG_DEBUG("game", "=== СБРОС ЗАВЕРШЕН ===");
 }
 
 void Game::updateStats() {
-    std::stringstream statsSS;
-    statsSS << "Player: " << (player ? player->getName() : "Guest") << "\n\n"
-            << "Difficulty: " << getDifficultyString() << "\n\n"
-            << "Field: " << rows << "x" << cols << " (" << (rows * cols) << " cards)\n\n"
-            << "Moves: " << moves << "\n\n"
-            << "Pairs found: " << matchedPairs << "/" << totalPairs << "\n\n"
-            << "Progress: " << std::fixed << std::setprecision(1) 
-            << (totalPairs > 0 ? (matchedPairs * 100.0 / totalPairs) : 0) << "%";
-    
-    statsText.setString(statsSS.str());
-    statsText.setLineSpacing(1.2f);
+    // Тексты HUD пересобираем только когда изменились показываемые значения
+    bool rebuildAll = !hudModel.isValid();
+    bool timerChanged = hudModel.setTimer(static_cast<int>(elapsedTime.asSeconds()));
+    bool progressChanged = hudModel.setProgress(moves, matchedPairs, totalPairs);
+    
+    if (timerChanged) {
+        timerText.setString(hudModel.formatTimer());
+    }
+    
+    if (progressChanged) {
+        std::stringstream statsSS;
+        statsSS << "Player: " << (player ? player->getName() : "Guest") << "\n\n"
+                << "Difficulty: " << getDifficultyString() << "\n\n"
+                << "Field: " << rows << "x" << cols << " (" << (rows * cols) << " cards)\n\n"
+                << "Moves: " << moves << "\n\n"
+                << "Pairs found: " << matchedPairs << "/" << totalPairs << "\n\n"
+                << "Progress: " << std::fixed << std::setprecision(1) 
+                << (totalPairs > 0 ? (matchedPairs * 100.0 / totalPairs) : 0) << "%";
+        
+        statsText.setString(statsSS.str());
+        statsText.setLineSpacing(1.2f);
+    }
     
-    if (player) {
+    // Счет зависит только от секунд, ходов и пар
+    if (player && (timerChanged || progressChanged)) {
         player->calculateScore(totalPairs);
-        scoreText.setString("Score: " + std::to_string(player->getScore()));
+        if (hudModel.setScore(player->getScore())) {
+            scoreText.setString(hudModel.formatScore());
+        }
+    }
+    
+    if (rebuildAll) {
+        difficultyText.setString("Difficulty: " + getDifficultyString());
+        difficultyText.setFillColor(getDifficultyColor());
+    }
+    
+    hudModel.markValid();
+}
+
+void Game::setupBoardView() {
+    sf::FloatRect area = getBoardArea();
+    sf::Vector2f areaSize(area.width, area.height);
+    boardView.setSize(areaSize);
+    boardView.setCenter(area.left + area.width / 2.0f, area.top + area.height / 2.0f);
+    isPanningBoard = false;
+    
+    // Большое поле отдаляем так, чтобы оно влезло, но не дальше предела масштаба
+    sf::FloatRect bounds = boardLayout.getBounds();
+    float fit = std::max(bounds.width / areaSize.x, bounds.height / areaSize.y);
+    if (fit > 1.0f) {
+        boardView.setSize(areaSize * std::min(fit, boardMaxZoom));
+        boardView.setCenter(bounds.left + bounds.width / 2.0f, bounds.top + bounds.height / 2.0f);
+    }
+    
+    clampBoardView();
+}
+
+bool Game::isBoardViewMovable() const {
+    return difficulty == Difficulty::CUSTOM;
+}
+
+bool Game::handleBoardViewEvent(const sf::Event& event) {
+    if (!isBoardViewMovable()) return false;
+    
+    switch (event.type) {
+        case sf::Event::MouseWheelScrolled:
+            if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+                zoomBoardView(event.mouseWheelScroll.delta > 0 ? 1.0f / 1.15f : 1.15f,
+                              sf::Vector2i(event.mouseWheelScroll.x, event.mouseWheelScroll.y));
+                return true;
+            }
+            break;
+            
+        case sf::Event::MouseButtonPressed:
+            if (event.mouseButton.button == sf::Mouse::Right ||
+                event.mouseButton.button == sf::Mouse::Middle) {
+                isPanningBoard = true;
+                lastPanPosition = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+                return true;
+            }
+            break;
+            
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Right ||
+                event.mouseButton.button == sf::Mouse::Middle) {
+                isPanningBoard = false;
+                return true;
+            }
+            break;
+            
+        case sf::Event::MouseMoved:
+            if (isPanningBoard) {
+                sf::Vector2i current(event.mouseMove.x, event.mouseMove.y);
+                boardView.move(window.mapPixelToCoords(lastPanPosition, boardView) -
+                               window.mapPixelToCoords(current, boardView));
+                lastPanPosition = current;
+                clampBoardView();
+                return true;
+            }
+            break;
+            
+        case sf::Event::KeyPressed:
+            if (event.key.code == sf::Keyboard::Home) {
+                setupBoardView();
+                return true;
+            }
+            break;
+            
+        default:
+            break;
     }
     
-    difficultyText.setString("Difficulty: " + getDifficultyString());
-    difficultyText.setFillColor(getDifficultyColor());
+    return false;
+}
+
+void Game::zoomBoardView(float factor, const sf::Vector2i& pixel) {
+    // Точка под курсором остается на месте
+    sf::Vector2f before = window.mapPixelToCoords(pixel, boardView);
+    
+    sf::FloatRect area = getBoardArea();
+    float zoom = boardView.getSize().x * factor / area.width;
+    zoom = std::max(0.5f, std::min(zoom, boardMaxZoom));
+    boardView.setSize(sf::Vector2f(area.width * zoom, area.height * zoom));
+    
+    sf::Vector2f after = window.mapPixelToCoords(pixel, boardView);
+    boardView.move(before - after);
+    clampBoardView();
+}
+
+void Game::clampBoardView() {
+    // Центр камеры не уходит за пределы поля
+    sf::FloatRect bounds = boardLayout.getBounds();
+    sf::Vector2f center = boardView.getCenter();
+    center.x = std::max(bounds.left, std::min(center.x, bounds.left + bounds.width));
+    center.y = std::max(bounds.top, std::min(center.y, bounds.top + bounds.height));
+    boardView.setCenter(center);
+}
+
+BoardLayout::Range Game::getVisibleBoardRange() const {
+    sf::Vector2f size = boardView.getSize();
+    sf::Vector2f center = boardView.getCenter();
+    return boardLayout.getRange(sf::FloatRect(center.x - size.x / 2.0f, center.y - size.y / 2.0f,
+                                              size.x, size.y));
 }
 
 void Game::handleLoginInput(sf::Event event) {
@@ -2210,238 +2422,280 @@ void Game::handleRegisterInput(sf::Event event) {
 
 void Game::handleEvents() {
     sf::Event event;
-    sf::Vector2f mousePos = static_cast<sf::Vector2f>(sf::Mouse::getPosition(window));
+    sf::Vector2f mousePos = getCanvasMousePosition();
     
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
-        
-        if (event.type == sf::Event::Resized) {
-            sf::FloatRect visibleArea(0, 0, event.size.width, event.size.height);
-            window.setView(sf::View(visibleArea));
-            updateBackgrounds();
-        }
-        
-        // Обработка колесика мыши для скроллинга достижений
-        if (currentState == GameState::ACHIEVEMENTS && event.type == sf::Event::MouseWheelScrolled) {
-            if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
-                auto allAchievements = achievementManager ? achievementManager->getAllAchievements() : std::vector<Achievement>();
-                float totalContentHeight = allAchievements.size() * 70.0f;
-                float visibleHeight = 400;
+        processEvent(event, mousePos);
+    }
+}
+
+void Game::processEvent(const sf::Event& event, const sf::Vector2f& mousePos) {
+    // Любое событие может изменить картинку на экране
+    needsRedraw = true;
+    
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+    
+    // Оверлей профайлера
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+        profiler.toggleHud();
+        profilerHudClock.restart();
+        profilerText.setString(profiler.buildSummary());
+    }
+    
+    if (event.type == sf::Event::MouseMoved) {
+        updateButtonHover(window.mapPixelToCoords(
+            sf::Vector2i(event.mouseMove.x, event.mouseMove.y), canvasView));
+    }
+    
+    if (event.type == sf::Event::MouseButtonReleased) {
+        releaseButtons(window.mapPixelToCoords(
+            sf::Vector2i(event.mouseButton.x, event.mouseButton.y), canvasView), event);
+    }
+    
+    if (event.type == sf::Event::Resized) {
+        // Раскладка задана в координатах холста - пересчитываем только полосы
+        applyCanvasViewport(event.size.width, event.size.height);
+    }
+    
+    // Обработка колесика мыши для скроллинга достижений
+    if (currentState == GameState::ACHIEVEMENTS && event.type == sf::Event::MouseWheelScrolled) {
+        if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+            auto allAchievements = achievementManager ? achievementManager->getAllAchievements() : std::vector<Achievement>();
+            float totalContentHeight = allAchievements.size() * 70.0f;
+            float visibleHeight = 400;
+            
+            if (totalContentHeight > visibleHeight) {
+                achievementsScrollOffset -= event.mouseWheelScroll.delta * 20.0f; // Скорость прокрутки
                 
-                if (totalContentHeight > visibleHeight) {
-                    achievementsScrollOffset -= event.mouseWheelScroll.delta * 20.0f; // Скорость прокрутки
-                    
-                    // Ограничиваем смещение
-                    float maxScroll = totalContentHeight - visibleHeight;
-                    achievementsScrollOffset = std::max(0.0f, std::min(maxScroll, achievementsScrollOffset));
-                }
+                // Ограничиваем смещение
+                float maxScroll = totalContentHeight - visibleHeight;
+                achievementsScrollOffset = std::max(0.0f, std::min(maxScroll, achievementsScrollOffset));
+                achievementsCache.invalidate();
             }
         }
-        
-        switch (currentState) {
-            case GameState::LOGIN_SCREEN:
-                handleLoginInput(event);
-                for (auto& button : loginButtons) {
-                    button.handleEvent(event, mousePos);
-                }
-                
-                // Обработка кликов по полям ввода
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.button == sf::Mouse::Left) {
-                        sf::FloatRect usernameBounds(400, 290, 400, 40);
-                        sf::FloatRect passwordBounds(400, 390, 400, 40);
-                        
-                        if (usernameBounds.contains(mousePos)) {
-                            activeInputField = InputField::USERNAME;
-                        } else if (passwordBounds.contains(mousePos)) {
-                            activeInputField = InputField::PASSWORD;
-                        } else {
-                            activeInputField = InputField::NONE;
-                        }
+    }
+    
+    switch (currentState) {
+        case GameState::LOGIN_SCREEN:
+            handleLoginInput(event);
+            for (auto& button : loginButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            
+            // Обработка кликов по полям ввода
+            if (event.type == sf::Event::MouseButtonPressed) {
+                if (event.mouseButton.button == sf::Mouse::Left) {
+                    sf::FloatRect usernameBounds(400, 290, 400, 40);
+                    sf::FloatRect passwordBounds(400, 390, 400, 40);
+                    
+                    if (usernameBounds.contains(mousePos)) {
+                        activeInputField = InputField::USERNAME;
+                    } else if (passwordBounds.contains(mousePos)) {
+                        activeInputField = InputField::PASSWORD;
+                    } else {
+                        activeInputField = InputField::NONE;
                     }
                 }
-                break;
-                
-            case GameState::REGISTER_SCREEN:
-                handleRegisterInput(event);
-                for (auto& button : registerButtons) {
-                    button.handleEvent(event, mousePos);
-                }
-                
-                // Обработка кликов по полям ввода
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.button == sf::Mouse::Left) {
-                        sf::FloatRect usernameBounds(400, 190, 400, 40);
-                        sf::FloatRect emailBounds(400, 290, 400, 40);
-                        sf::FloatRect passwordBounds(400, 390, 400, 40);
-                        sf::FloatRect confirmBounds(400, 490, 400, 40);
-                        
-                        if (usernameBounds.contains(mousePos)) {
-                            activeInputField = InputField::USERNAME;
-                        } else if (emailBounds.contains(mousePos)) {
-                            activeInputField = InputField::EMAIL;
-                        } else if (passwordBounds.contains(mousePos)) {
-                            activeInputField = InputField::PASSWORD;
-                        } else if (confirmBounds.contains(mousePos)) {
-                            activeInputField = InputField::CONFIRM_PASSWORD;
-                        } else {
-                            activeInputField = InputField::NONE;
-                        }
+            }
+            break;
+            
+        case GameState::REGISTER_SCREEN:
+            handleRegisterInput(event);
+            for (auto& button : registerButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            
+            // Обработка кликов по полям ввода
+            if (event.type == sf::Event::MouseButtonPressed) {
+                if (event.mouseButton.button == sf::Mouse::Left) {
+                    sf::FloatRect usernameBounds(400, 190, 400, 40);
+                    sf::FloatRect emailBounds(400, 290, 400, 40);
+                    sf::FloatRect passwordBounds(400, 390, 400, 40);
+                    sf::FloatRect confirmBounds(400, 490, 400, 40);
+                    
+                    if (usernameBounds.contains(mousePos)) {
+                        activeInputField = InputField::USERNAME;
+                    } else if (emailBounds.contains(mousePos)) {
+                        activeInputField = InputField::EMAIL;
+                    } else if (passwordBounds.contains(mousePos)) {
+                        activeInputField = InputField::PASSWORD;
+                    } else if (confirmBounds.contains(mousePos)) {
+                        activeInputField = InputField::CONFIRM_PASSWORD;
+                    } else {
+                        activeInputField = InputField::NONE;
                     }
                 }
-                break;
-                
-            case GameState::MAIN_MENU:
-                for (auto& button : mainMenuButtons) {
-                    button.handleEvent(event, mousePos);
-                }
-                break;
-                
-            case GameState::ENTER_NAME:
-                if (event.type == sf::Event::TextEntered) {
-                    if (event.text.unicode == '\b') {
-                        if (!playerNameInput.empty()) {
-                            playerNameInput.pop_back();
-                        }
-                    } else if (event.text.unicode == '\r') {
-                        if (!playerNameInput.empty()) {
-                            player = std::make_unique<Player>(playerNameInput);
-                            if (achievementManager) {
-                                achievementManager->setPlayerName(playerNameInput);
-                            }
-                            currentState = GameState::SETUP;
-                            isEnteringName = false;
-                            std::cout << "Игрок создан: " << playerNameInput << std::endl;
-                        }
-                    } else if (event.text.unicode >= 32 && event.text.unicode < 128) {
-                        if (playerNameInput.length() < 20) {
-                            playerNameInput += static_cast<char>(event.text.unicode);
-                        }
+            }
+            break;
+            
+        case GameState::MAIN_MENU:
+            for (auto& button : mainMenuButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            break;
+            
+        case GameState::ENTER_NAME:
+            if (event.type == sf::Event::TextEntered) {
+                if (event.text.unicode == '\b') {
+                    if (!playerNameInput.empty()) {
+                        playerNameInput.pop_back();
                     }
-                }
-                break;
-                
-            case GameState::SETUP:
-                for (auto& button : setupButtons) {
-                    button.handleEvent(event, mousePos);
-                }
-                break;
-                
-            case GameState::PLAYING:
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.button == sf::Mouse::Left) {
-                        for (size_t i = 0; i < cards.size(); i++) {
-                            if (cards[i]->contains(mousePos) && 
-                                cards[i]->getState() == CardState::HIDDEN &&
-                                cards[i]->getIsClickable() &&
-                                !isFlipping && !isChecking) {
-                                handleCardClick(i);
-                                break;
-                            }
+                } else if (event.text.unicode == '\r') {
+                    if (!playerNameInput.empty()) {
+                        player = std::make_unique<Player>(playerNameInput);
+                        if (achievementManager) {
+                            achievementManager->setPlayerName(playerNameInput);
                         }
-                        
-                        surrenderButton.handleEvent(event, mousePos);
+                        currentState = GameState::SETUP;
+                        isEnteringName = false;
+                        prefetchCardImages();
+                        LOG_INFO("game", "Игрок создан: " << playerNameInput);
+                    }
+                } else if (event.text.unicode >= 32 && event.text.unicode < 128) {
+                    if (playerNameInput.length() < 20) {
+                        playerNameInput += static_cast<char>(event.text.unicode);
                     }
                 }
-                for (auto& button : gameButtons) {
-                    button.handleEvent(event, mousePos);
-                }
+            }
+            break;
+            
+        case GameState::SETUP:
+            for (auto& button : setupButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            break;
+            
+        case GameState::PLAYING:
+            if (handleBoardViewEvent(event)) {
                 break;
-                
-            case GameState::PAUSED:
-                for (auto& button : pauseButtons) {
-                    button.handleEvent(event, mousePos);
+            }
+            
+            if (event.type == sf::Event::MouseButtonPressed &&
+                event.mouseButton.button == sf::Mouse::Left) {
+                // Кнопки лежат поверх поля: клик по ним карту не переворачивает
+                bool onButton = surrenderButton.getShape().getGlobalBounds().contains(mousePos);
+                for (const auto& button : gameButtons) {
+                    onButton = onButton || button.getShape().getGlobalBounds().contains(mousePos);
                 }
-                break;
                 
-            case GameState::GAME_OVER_WIN:
-            case GameState::GAME_OVER_LOSE:
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.button == sf::Mouse::Left) {
-                        if (mousePos.x >= window.getSize().x / 2 - 150 && 
-                            mousePos.x <= window.getSize().x / 2 + 150 &&
-                            mousePos.y >= window.getSize().y - 150 && 
-                            mousePos.y <= window.getSize().y - 90) {
-                            currentState = GameState::MAIN_MENU;
-                            background.setTexture(menuBackgroundTexture);
-                        }
+                if (onButton) {
+                    surrenderButton.handleEvent(event, mousePos);
+                    for (auto& button : gameButtons) {
+                        button.handleEvent(event, mousePos);
                     }
+                    break;
                 }
-                break;
                 
-            case GameState::LEADERBOARD:
-                for (auto& button : leaderboardButtons) {
-                    button.handleEvent(event, mousePos);
+                // Вне области поля карты обрезаны - там их не выбираем
+                if (!getBoardArea().contains(mousePos)) {
+                    break;
                 }
-                break;
                 
-            case GameState::ACHIEVEMENTS:
-                for (auto& button : achievementsButtons) {
-                    button.handleEvent(event, mousePos);
-                }
-                break;
+                // Карту под курсором вычисляем по сетке, без перебора всех карт
+                sf::Vector2f boardPos = window.mapPixelToCoords(
+                    sf::Vector2i(event.mouseButton.x, event.mouseButton.y), boardView);
+                int i = boardLayout.cardAt(boardPos);
                 
-            case GameState::SETTINGS:
-                for (auto& button : settingsButtons) {
-                    button.handleEvent(event, mousePos);
+                if (i >= 0 && i < static_cast<int>(cards.size()) &&
+                    cards[i]->getState() == CardState::HIDDEN &&
+                    cards[i]->getIsClickable()) {
+                    // Во время переворота/проверки клик ставится в очередь
+                    if (isFlipping || isChecking) {
+                        queueCardClick(i);
+                    } else {
+                        handleCardClick(i);
+                    }
                 }
                 break;
-                
-            case GameState::CONTACT_FORM:
-                contactForm.handleEvent(event, mousePos);
-                
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.button == sf::Mouse::Left) {
-                        if (contactForm.isMouseOverBackButton(mousePos)) {
-                            currentState = previousState;
-                            background.setTexture(menuBackgroundTexture);
-                        }
+            }
+            
+            for (auto& button : gameButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            break;
+            
+        case GameState::PAUSED:
+            for (auto& button : pauseButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            break;
+            
+        case GameState::GAME_OVER_WIN:
+        case GameState::GAME_OVER_LOSE:
+            if (event.type == sf::Event::MouseButtonPressed) {
+                if (event.mouseButton.button == sf::Mouse::Left) {
+                    if (mousePos.x >= getCanvasSize().x / 2 - 150 && 
+                        mousePos.x <= getCanvasSize().x / 2 + 150 &&
+                        mousePos.y >= getCanvasSize().y - 150 && 
+                        mousePos.y <= getCanvasSize().y - 90) {
+                        currentState = GameState::MAIN_MENU;
+                        background.setTexture(menuBackgroundTexture);
                     }
                 }
-                break;
-                
-            case GameState::EXIT:
-                window.close();
-                break;
-        }
-    }
-}
-
-void Game::update(float deltaTime) {
-    sf::Vector2f mousePos = static_cast<sf::Vector2f>(sf::Mouse::getPosition(window));
-    
-    switch (currentState) {
-        case GameState::MAIN_MENU:
-            for (auto& button : mainMenuButtons) button.update(mousePos);
+            }
             break;
             
-        case GameState::ENTER_NAME:
+        case GameState::LEADERBOARD:
+            for (auto& button : leaderboardButtons) {
+                button.handleEvent(event, mousePos);
+            }
             break;
             
-        case GameState::SETUP:
-            for (auto& button : setupButtons) button.update(mousePos);
+        case GameState::ACHIEVEMENTS:
+            for (auto& button : achievementsButtons) {
+                button.handleEvent(event, mousePos);
+            }
+            break;
+            
+        case GameState::SETTINGS:
+            for (auto& button : settingsButtons) {
+                button.handleEvent(event, mousePos);
+            }
             break;
             
+        case GameState::CONTACT_FORM:
+            contactForm.handleEvent(event, mousePos);
+            
+            if (event.type == sf::Event::MouseButtonPressed) {
+                if (event.mouseButton.button == sf::Mouse::Left) {
+                    if (contactForm.isMouseOverBackButton(mousePos)) {
+                        currentState = previousState;
+                        background.setTexture(menuBackgroundTexture);
+                    }
+                }
+            }
+            break;
+            
+        case GameState::EXIT:
+            window.close();
+            break;
+    }
+}
+
+void Game::update(float deltaTime) {
+    // Выполняем отложенные действия, время которых подошло.
+    // На паузе время партии стоит, и отложенное скрытие карт ждет вместе с ним
+    if (currentState != GameState::PAUSED) {
+        scheduler.update(deltaTime);
+    }
+    
+    // Наведение меняется по MouseMoved; при смене экрана сверяем его с курсором один раз
+    if (currentState != hoverState) {
+        hoverState = currentState;
+        updateButtonHover(getCanvasMousePosition());
+    }
+    
+    switch (currentState) {
         case GameState::PLAYING:
             if (isGameActive) {
-                elapsedTime = gameClock.getElapsedTime();
-                
-                int seconds = static_cast<int>(elapsedTime.asSeconds());
-                int minutes = seconds / 60;
-                seconds %= 60;
-                std::stringstream timeSS;
-                timeSS << std::setfill('0') << std::setw(2) << minutes << ":"
-                       << std::setfill('0') << std::setw(2) << seconds;
-                timerText.setString("Time: " + timeSS.str());
-                
+                // Время партии копится из шагов логики: пауза и ограничение
+                // долгих кадров действуют на него так же, как на остальную игру
+                elapsedTime += sf::seconds(deltaTime);
                 updateStats();
             }
             
-            for (auto& button : gameButtons) button.update(mousePos);
-            surrenderButton.update(mousePos);
-            
             if (isFlipping) {
                 cardFlipProgress += deltaTime;
                 if (cardFlipProgress >= cardFlipTime) {
@@ -2451,47 +2705,59 @@ void Game::update(float deltaTime) {
                     if (firstCard && secondCard) {
                         isChecking = true;
                         processCardMatch();
+                    } else {
+                        processQueuedClicks();
                     }
                 }
             }
             break;
             
-        case GameState::PAUSED:
-            for (auto& button : pauseButtons) button.update(mousePos);
-            break;
-            
-        case GameState::GAME_OVER_WIN:
-            break;
-            
-        case GameState::GAME_OVER_LOSE:
-            break;
-            
         case GameState::LEADERBOARD:
-            for (auto& button : leaderboardButtons) button.update(mousePos);
-            break;
-            
-        case GameState::ACHIEVEMENTS:
-            for (auto& button : achievementsButtons) button.update(mousePos);
-            break;
-            
-        case GameState::SETTINGS:
-            for (auto& button : settingsButtons) button.update(mousePos);
+            // Пришел новый снимок - экран нужно перерисовать
+            if (leaderboardService && leaderboardService->getVersion() != cachedLeaderboardVersion) {
+                markDirty();
+            }
             break;
             
         case GameState::CONTACT_FORM:
-            contactForm.update(mousePos);
+            contactForm.update(getCanvasMousePosition());
             break;
             
-        case GameState::EXIT:
+        default:
             break;
     }
     
-    for (auto& card : cards) {
-        card->update(deltaTime);
+    // Все анимации карт одним проходом; без активных твинов ничего не стоит
+    if (cardTweens.isAnimating()) {
+        ProfileScope tweenScope(profiler, "tweens");
+        cardTweens.update(deltaTime);
+    }
+    
+    // Салют живет только на экране победы
+    if (currentState != GameState::GAME_OVER_WIN && victoryParticles.isActive()) {
+        victoryParticles.clear();
+    }
+    
+    if (matchParticles.isActive() || victoryParticles.isActive()) {
+        ProfileScope particleScope(profiler, "particles");
+        matchParticles.update(deltaTime);
+        victoryParticles.update(deltaTime);
     }
 }
 
 void Game::render() {
+    needsRedraw = false;
+    lastRenderedState = currentState;
+    
+    ProfileScope renderScope(profiler, "render");
+    sf::Clock renderClock;
+    
+    // В режиме фиксированного шага кадр рисуется между шагами логики:
+    // досчитываем анимации на остаток шага, иначе кадры без шагов повторяются
+    if (useFixedTimestep && cardTweens.isAnimating()) {
+        cardTweens.sample(interpolationAlpha * fixedTimestep);
+    }
+    
     window.clear();
     
     // Устанавливаем правильный фон в зависимости от состояния
@@ -2508,7 +2774,14 @@ void Game::render() {
         background.setTexture(gameBackgroundTexture);
     }
     
-    window.draw(background);
+    // Какой фон выбран, определяет текстура; цвет с яркостью - цвет вершин
+    background.setColor(applyBrightness(background.getTexture() == &gameBackgroundTexture
+                                        ? gameBackgroundColor : menuBackgroundColor));
+    
+    // У меню со слоем фон уже запечен в слой
+    if (!isLayeredScreen(currentState)) {
+        window.draw(background);
+    }
     
     switch (currentState) {
         case GameState::LOGIN_SCREEN:
@@ -2571,108 +2844,126 @@ void Game::render() {
             break;
     }
     
+    if (profiler.isHudVisible()) {
+        renderProfilerHud();
+    }
+    
+    // Плотность частиц подстраиваем по времени отрисовки без ожидания vsync
+    if (matchParticles.isActive() || victoryParticles.isActive()) {
+        float renderWork = renderClock.getElapsedTime().asSeconds();
+        matchParticles.adaptQuality(renderWork, frameStats.getTargetFrameTime());
+        victoryParticles.adaptQuality(renderWork, frameStats.getTargetFrameTime());
+    }
+    
+    // display() включает ожидание vsync/лимитера кадров - меряем отдельно
+    renderScope.stop();
+    ProfileScope displayScope(profiler, "display");
     window.display();
 }
 
-void Game::renderGameOverWin() {
-    std::cout << "=== ОТРИСОВКА ЭКРАНА ПОБЕДЫ ===" << std::endl;
-    std::cout << "Статистика: " << matchedPairs << "/" << totalPairs << " пар" << std::endl;
+void Game::invalidateScreenCaches() {
+    // Позиции элементов зависят от размера окна
+    leaderboardCache.invalidate();
+    achievementsCache.invalidate();
+    gameOverCache.invalidate();
+    pauseCache.invalidate();
+    menuLayer.invalidate();
+}
+
+void Game::renderProfilerHud() {
+    // Текст пересобираем 4 раза в секунду, а не каждый кадр
+    if (profilerHudClock.getElapsedTime().asSeconds() >= 0.25f) {
+        profilerHudClock.restart();
+        profilerText.setString(profiler.buildSummary());
+    }
     
-    // Поздравление с победой
-    sf::Text victoryText("VICTORY!", mainFont, 72);
-    victoryText.setFillColor(sf::Color(255, 215, 0));
-    victoryText.setStyle(sf::Text::Bold);
+    sf::FloatRect bounds = profilerText.getGlobalBounds();
+    profilerBackground.setPosition(bounds.left - 8, bounds.top - 8);
+    profilerBackground.setSize(sf::Vector2f(bounds.width + 16, bounds.height + 16));
     
-    sf::FloatRect bounds = victoryText.getLocalBounds();
-    victoryText.setOrigin(bounds.left + bounds.width / 2.0f,
-                         bounds.top + bounds.height / 2.0f);
-    victoryText.setPosition(window.getSize().x / 2, 150);
-    window.draw(victoryText);
+    window.draw(profilerBackground);
+    window.draw(profilerText);
+}
+
+void Game::renderGameOverWin() {
+    ProfileScope scope(profiler, "renderGameOverWin");
     
-    // Проверяем полученные достижения
-    if (achievementManager) {
-        auto unlockedAchievements = achievementManager->getUnlockedAchievements();
-        
-        // Показываем только недавно полученные достижения (первые 3)
-        int recentAchievements = 0;
-        for (const auto& achievement : unlockedAchievements) {
-            if (recentAchievements < 3) {
-                // Иконка достижения
-                sf::Text achievementIcon(achievement.icon, mainFont, 36);
-                sf::Color rarityColor = achievement.getRarityColor();
-                
-                achievementIcon.setFillColor(rarityColor);
-                achievementIcon.setPosition(100 + recentAchievements * 150, 400);
-                window.draw(achievementIcon);
-                
-                // Название достижения
-                sf::Text achievementName(achievement.title, mainFont, 18);
-                achievementName.setFillColor(sf::Color::White);
-                achievementName.setPosition(100 + recentAchievements * 150, 450);
-                window.draw(achievementName);
-                
-                recentAchievements++;
+    if (!gameOverCache.isValid() || gameOverCacheState != GameState::GAME_OVER_WIN) {
+        gameOverCache.beginRebuild();
+        gameOverCacheState = GameState::GAME_OVER_WIN;
+        
+        LOG_DEBUG("render", "=== ОТРИСОВКА ЭКРАНА ПОБЕДЫ === Статистика: " << matchedPairs << "/" << totalPairs << " пар");
+        
+        // Поздравление с победой
+        sf::Text& victoryText = gameOverCache.addText("VICTORY!", mainFont, 72);
+        victoryText.setFillColor(sf::Color(255, 215, 0));
+        victoryText.setStyle(sf::Text::Bold);
+        
+        sf::FloatRect bounds = victoryText.getLocalBounds();
+        victoryText.setOrigin(bounds.left + bounds.width / 2.0f,
+                             bounds.top + bounds.height / 2.0f);
+        victoryText.setPosition(getCanvasSize().x / 2, 150);
+        
+        // Проверяем полученные достижения
+        if (achievementManager) {
+            auto unlockedAchievements = achievementManager->getUnlockedAchievements();
+            
+            // Показываем только недавно полученные достижения (первые 3)
+            int recentAchievements = 0;
+            for (const auto& achievement : unlockedAchievements) {
+                if (recentAchievements < 3) {
+                    // Иконка достижения
+                    sf::Text& achievementIcon = gameOverCache.addText(achievement.icon, mainFont, 36);
+                    achievementIcon.setFillColor(achievement.getRarityColor());
+                    achievementIcon.setPosition(100 + recentAchievements * 150, 400);
+                    
+                    // Название достижения
+                    sf::Text& achievementName = gameOverCache.addText(achievement.title, mainFont, 18);
+                    achievementName.setFillColor(sf::Color::White);
+                    achievementName.setPosition(100 + recentAchievements * 150, 450);
+                    
+                    recentAchievements++;
+                }
+            }
+            
+            if (recentAchievements > 0) {
+                sf::Text& newAchievementsText = gameOverCache.addText("New Achievements Unlocked!", mainFont, 24);
+                newAchievementsText.setFillColor(sf::Color::Green);
+                newAchievementsText.setPosition(getCanvasSize().x / 2 - 150, 350);
             }
         }
         
-        if (recentAchievements > 0) {
-            sf::Text newAchievementsText("New Achievements Unlocked!", mainFont, 24);
-            newAchievementsText.setFillColor(sf::Color::Green);
-            newAchievementsText.setPosition(window.getSize().x / 2 - 150, 350);
-            window.draw(newAchievementsText);
+        // Статистика
+        if (player) {
+            std::stringstream stats;
+            stats << "Player: " << player->getName() << "\n\n";
+            stats << "Final Score: " << player->getScore() << "\n";
+            stats << "Moves: " << moves << "\n";
+            stats << "Perfect Match: " << (moves == totalPairs ? "YES!" : "No") << "\n";
+            stats << "Time: " << (int)elapsedTime.asSeconds() << " seconds\n";
+            stats << "Difficulty: " << getDifficultyString();
+            
+            sf::Text& statsText = gameOverCache.addText(stats.str(), mainFont, 32);
+            statsText.setFillColor(sf::Color::White);
+            statsText.setPosition(getCanvasSize().x / 2 - 200, 200);
         }
-    }
-    
-    // Статистика
-    if (player) {
-        std::stringstream stats;
-        stats << "Player: " << player->getName() << "\n\n";
-        stats << "Final Score: " << player->getScore() << "\n";
-        stats << "Moves: " << moves << "\n";
-        stats << "Perfect Match: " << (moves == totalPairs ? "YES!" : "No") << "\n";
-        stats << "Time: " << (int)elapsedTime.asSeconds() << " seconds\n";
-        stats << "Difficulty: " << getDifficultyString();
         
-        sf::Text statsText(stats.str(), mainFont, 32);
-        statsText.setFillColor(sf::Color::White);
-        statsText.setPosition(window.getSize().x / 2 - 200, 200);
-        window.draw(statsText);
+        addGameOverButton("Continue to Menu");
     }
     
-    // Кнопка продолжения
-    sf::RectangleShape continueButton(sf::Vector2f(300, 60));
-    continueButton.setPosition(window.getSize().x / 2 - 150, window.getSize().y - 150);
-    
-    sf::Vector2f mousePos = static_cast<sf::Vector2f>(sf::Mouse::getPosition(window));
-    bool isMouseOverButton = continueButton.getGlobalBounds().contains(mousePos);
+    sf::Vector2f mousePos = getCanvasMousePosition();
+    bool isMouseOverButton = gameOverButton->getGlobalBounds().contains(mousePos);
     
     if (isMouseOverButton) {
-        continueButton.setFillColor(sf::Color(50, 205, 50));
-        continueButton.setOutlineColor(sf::Color::Yellow);
+        gameOverButton->setFillColor(sf::Color(50, 205, 50));
+        gameOverButton->setOutlineColor(sf::Color::Yellow);
     } else {
-        continueButton.setFillColor(sf::Color(0, 200, 0));
-        continueButton.setOutlineColor(sf::Color::White);
+        gameOverButton->setFillColor(sf::Color(0, 200, 0));
+        gameOverButton->setOutlineColor(sf::Color::White);
     }
     
-    continueButton.setOutlineThickness(2);
-    window.draw(continueButton);
-    
-    sf::Text continueText("Continue to Menu", mainFont, 28);
-    continueText.setFillColor(sf::Color::White);
-    sf::FloatRect continueBounds = continueText.getLocalBounds();
-    continueText.setOrigin(continueBounds.left + continueBounds.width / 2.0f,
-                          continueBounds.top + continueBounds.height / 2.0f);
-    continueText.setPosition(window.getSize().x / 2, window.getSize().y - 120);
-    
-    // Тень
-    sf::Text shadowText = continueText;
-    shadowText.setFillColor(sf::Color(0, 0, 0, 150));
-    shadowText.move(2, 2);
-    window.draw(shadowText);
-    
-    window.draw(continueText);
-    
-    std::cout << "✅ Экран победы отрисован" << std::endl;
+    gameOverCache.render(window);
+    victoryParticles.render(window);
 }
 
 void Game::handleCardClick(int cardIndex) {
@@ -2705,6 +2996,7 @@ void Game::handleCardClick(int cardIndex) {
     // Переворачиваем карту
     cards[cardIndex]->reveal();
     cards[cardIndex]->setClickable(false);
+    cardTweens.start(cards[cardIndex].get(), TweenSystem::Property::Flip, cardFlipTime);
     
     if (!firstCardSelected) {
         // Первая карта
@@ -2731,19 +3023,17 @@ void Game::handleCardClick(int cardIndex) {
 }
 
 void Game::processCardMatch() {
-    std::cout << "=== ПРОВЕРКА СОВПАДЕНИЯ КАРТ ===" << std::endl;
-    std::cout << "Найдено пар: " << matchedPairs << "/" << totalPairs << std::endl;
+    LOG_DEBUG("game", "=== ПРОВЕРКА СОВПАДЕНИЯ КАРТ === Найдено пар: " << matchedPairs << "/" << totalPairs);
     
     if (!firstCard || !secondCard || !isChecking) {
-        std::cout << "Ошибка: карты не инициализированы" << std::endl;
+        LOG_WARNING("game", "Ошибка: карты не инициализированы");
         return;
     }
     
     // Проверяем совпадение
     bool match = (firstCard->getSymbol() == secondCard->getSymbol());
-    std::cout << "Символ 1: '" << firstCard->getSymbol() << "'" << std::endl;
-    std::cout << "Символ 2: '" << secondCard->getSymbol() << "'" << std::endl;
-    std::cout << "Совпадение: " << (match ? "ДА" : "НЕТ") << std::endl;
+    LOG_DEBUG("game", "Символ 1: '" << firstCard->getSymbol() << "', символ 2: '"
+              << secondCard->getSymbol() << "', совпадение: " << (match ? "ДА" : "НЕТ"));
     
     if (match) {
         // Совпадение
@@ -2756,7 +3046,7 @@ void Game::processCardMatch() {
         
         // Проверяем достижение "Combo Master" (3 совпадения подряд без ошибок)
         if (consecutiveMatches >= 3 && achievementManager) {
-            std::cout << "🎯 3 matches in a row! Combo Master progress" << std::endl;
+            LOG_DEBUG("game", "🎯 3 matches in a row! Combo Master progress");
             achievementManager->recordPerfectMatch();
             achievementManager->updateAchievement(AchievementType::COMBO_MASTER);
         }
@@ -2764,10 +3054,18 @@ void Game::processCardMatch() {
         // Помечаем как совпавшие
         firstCard->markMatched();
         secondCard->markMatched();
+        cardTweens.start(firstCard, TweenSystem::Property::Pulse, 0.35f);
+        cardTweens.start(secondCard, TweenSystem::Property::Pulse, 0.35f);
+        
+        for (CardSprite* card : {firstCard, secondCard}) {
+            const sf::RectangleShape& shape = card->getShape();
+            sf::Vector2f center = shape.getPosition() + shape.getSize() / 2.0f;
+            matchParticles.burst(center, sf::Color(255, 215, 0), 40);
+        }
         
         // Увеличиваем счетчик совпавших пар
         matchedPairs++;
-        std::cout << "✅ НОВАЯ ПАРА НАЙДЕНА! Всего: " << matchedPairs << "/" << totalPairs << std::endl;
+        LOG_DEBUG("game", "✅ НОВАЯ ПАРА НАЙДЕНА! Всего: " << matchedPairs << "/" << totalPairs);
         
         if (player) {
             player->incrementMatchedPairs();
@@ -2781,7 +3079,7 @@ void Game::processCardMatch() {
             // Проверяем быстрый подбор пары
             double pairTime = pairTimer.getElapsedTime().asSeconds();
             if (pairTime < 3.0) {
-                std::cout << "⚡ Quick match: " << pairTime << " seconds" << std::endl;
+                LOG_DEBUG("game", "⚡ Quick match: " << pairTime << " seconds");
                 achievementManager->recordQuickMatch(pairTime);
                 achievementManager->updateAchievement(AchievementType::QUICK_THINKER);
             }
@@ -2793,8 +3091,7 @@ void Game::processCardMatch() {
         }
         
         if (matchedPairs >= totalPairs && !hasWon) {
-            std::cout << "🎉🎉🎉 ПОБЕДА! ВСЕ ПАРЫ НАЙДЕНЫ! 🎉🎉🎉" << std::endl;
-            std::cout << "Условие: " << matchedPairs << " >= " << totalPairs << std::endl;
+            LOG_INFO("game", "🎉🎉🎉 ПОБЕДА! ВСЕ ПАРЫ НАЙДЕНЫ! 🎉🎉🎉 (" << matchedPairs << "/" << totalPairs << ")");
             
             hasWon = true;
             isGameActive = false;
@@ -2815,7 +3112,7 @@ void Game::processCardMatch() {
                     } else {
                         achievementsPath = "achievements_" + player->getName() + ".dat";
                     }
-                    std::cout << "💾 Сохраняем достижения после победы: " << achievementsPath << std::endl;
+                    LOG_INFO("game", "💾 Сохраняем достижения после победы: " << achievementsPath);
                     achievementManager->saveToFile(achievementsPath);
                 }
             }
@@ -2824,8 +3121,10 @@ void Game::processCardMatch() {
                 soundManager->playGameWin();
             }
             
+            gameOverCache.invalidate();
+            victoryParticles.startConfetti(sf::FloatRect(0, 0, getCanvasSize().x, getCanvasSize().y), 4.0f);
             currentState = GameState::GAME_OVER_WIN;
-            std::cout << "Состояние изменено на GAME_OVER_WIN" << std::endl;
+            LOG_DEBUG("game", "Состояние изменено на GAME_OVER_WIN");
             return;
         }
     } else {
@@ -2837,19 +3136,30 @@ void Game::processCardMatch() {
         // Сбрасываем счетчик последовательных совпадений
         consecutiveMatches = 0;
         
-        isChecking = false;
-        
-        // Небольшая задержка
-        sf::Clock delayClock;
-        while (delayClock.getElapsedTime().asSeconds() < 0.8f) {
-            
-        }
+        // Пара остается открытой, пока не сработает отложенное скрытие.
+        // isChecking не сбрасываем - новые клики до этого идут в очередь
+        CardSprite* first = firstCard;
+        CardSprite* second = secondCard;
+        scheduler.schedule(mismatchDelay, [this, first, second]() {
+            first->hide();
+            second->hide();
+            first->setClickable(true);
+            second->setClickable(true);
+            cardTweens.start(first, TweenSystem::Property::Flip, cardFlipTime);
+            cardTweens.start(second, TweenSystem::Property::Flip, cardFlipTime);
+            LOG_DEBUG("game", "❌ Карты не совпали, переворачиваем обратно");
+            
+            firstCard = nullptr;
+            secondCard = nullptr;
+            selectedCard1 = -1;
+            selectedCard2 = -1;
+            isChecking = false;
+            
+            processQueuedClicks();
+        });
         
-        firstCard->hide();
-        secondCard->hide();
-        firstCard->setClickable(true);
-        secondCard->setClickable(true);
-        std::cout << "❌ Карты не совпали, переворачиваем обратно" << std::endl;
+        LOG_DEBUG("game", "=== ПРОВЕРКА ЗАВЕРШЕНА ===");
+        return;
     }
     
     // Сбрасываем выбор только если не победили
@@ -2859,9 +3169,40 @@ void Game::processCardMatch() {
         selectedCard1 = -1;
         selectedCard2 = -1;
         isChecking = false;
+        
+        processQueuedClicks();
     }
     
-    std::cout << "=== ПРОВЕРКА ЗАВЕРШЕНА ===\n" << std::endl;
+    LOG_DEBUG("game", "=== ПРОВЕРКА ЗАВЕРШЕНА ===");
+}
+
+void Game::queueCardClick(int cardIndex) {
+    // Хватает двух кликов - больше одной пары заранее не выбрать
+    if (queuedCardClicks.size() >= 2) {
+        return;
+    }
+    
+    if (std::find(queuedCardClicks.begin(), queuedCardClicks.end(), cardIndex) != queuedCardClicks.end()) {
+        return;
+    }
+    
+    queuedCardClicks.push_back(cardIndex);
+}
+
+void Game::processQueuedClicks() {
+    // Каждый клик запускает переворот, остальные ждут его окончания
+    while (!queuedCardClicks.empty() && isGameActive && !isFlipping && !isChecking) {
+        int cardIndex = queuedCardClicks.front();
+        queuedCardClicks.pop_front();
+        
+        if (cardIndex < 0 || cardIndex >= static_cast<int>(cards.size())) {
+            continue;
+        }
+        
+        if (cards[cardIndex]->getState() == CardState::HIDDEN && cards[cardIndex]->getIsClickable()) {
+            handleCardClick(cardIndex);
+        }
+    }
 }
 
 void Game::logoutUser() {
@@ -2875,7 +3216,7 @@ void Game::logoutUser() {
                 achievementsPath = "achievements_" + player->getName() + ".dat";
             }
             
-            std::cout << "💾 Сохраняем достижения перед выходом из аккаунта..." << std::endl;
+            LOG_INFO("game", "💾 Сохраняем достижения перед выходом из аккаунта...");
             achievementManager->saveToFile(achievementsPath);
         }
         
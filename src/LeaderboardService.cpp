@@ -0,0 +1,130 @@
+#include "LeaderboardService.h"
+#include "Logger.h"
+#include <algorithm>
+
+namespace {
+    const std::chrono::seconds BASE_RETRY_DELAY(5);
+    
+    bool sameRecords(const std::vector<GameRecord>& a, const std::vector<GameRecord>& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+            [](const GameRecord& x, const GameRecord& y) {
+                return x.id == y.id && x.playerName == y.playerName && x.score == y.score &&
+                       x.moves == y.moves && x.pairs == y.pairs && x.time == y.time &&
+                       x.date == y.date && x.difficulty == y.difficulty;
+            });
+    }
+}
+
+LeaderboardService::LeaderboardService(const std::string& connStr, int limit, std::chrono::seconds ttl)
+    : database(connStr),
+      limit(limit),
+      ttl(ttl),
+      retryDelay(BASE_RETRY_DELAY),
+      maxRetryDelay(std::chrono::seconds(60)),
+      failing(false),
+      stopRequested(false),
+      refreshRequested(true),
+      version(0),
+      hasData(false) {
+}
+
+LeaderboardService::~LeaderboardService() {
+    stop();
+}
+
+void LeaderboardService::start() {
+    if (worker.joinable()) {
+        return;
+    }
+    
+    stopRequested = false;
+    worker = std::thread(&LeaderboardService::workerLoop, this);
+}
+
+void LeaderboardService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    wakeUp.notify_all();
+    
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void LeaderboardService::invalidate() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        refreshRequested = true;
+    }
+    wakeUp.notify_all();
+}
+
+unsigned int LeaderboardService::getVersion() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return version;
+}
+
+std::vector<GameRecord> LeaderboardService::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return snapshot;
+}
+
+bool LeaderboardService::hasSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hasData;
+}
+
+void LeaderboardService::workerLoop() {
+    using SteadyClock = std::chrono::steady_clock;
+    
+    std::unique_lock<std::mutex> lock(mutex);
+    SteadyClock::time_point nextRefresh = SteadyClock::now();
+    
+    while (!stopRequested) {
+        if (refreshRequested || SteadyClock::now() >= nextRefresh) {
+            refreshRequested = false;
+            
+            // Запрос к БД идет без блокировки - отрисовка читает старый снимок
+            lock.unlock();
+            std::vector<GameRecord> records;
+            if (!database.isConnected()) {
+                // Сбрасываем оборванное подключение, иначе connect() его не пересоздаст
+                database.disconnect();
+                database.connect();
+            }
+            bool ok = database.isConnected() && database.fetchTopScores(limit, records);
+            lock.lock();
+            
+            if (ok) {
+                if (failing) {
+                    LOG_INFO("db", "Таблица рекордов снова обновляется");
+                    failing = false;
+                }
+                retryDelay = BASE_RETRY_DELAY;
+                
+                // Те же строки - версия не растет, и экран рекордов не перестраивается
+                if (!hasData || !sameRecords(records, snapshot)) {
+                    snapshot = std::move(records);
+                    version++;
+                }
+                hasData = true;
+                nextRefresh = SteadyClock::now() + ttl;
+            } else {
+                // Оставляем последний удачный снимок и пробуем позже, каждый раз реже
+                if (!failing) {
+                    LOG_WARNING("db", "Не удалось обновить таблицу рекордов, показываем прежний снимок");
+                    failing = true;
+                }
+                nextRefresh = SteadyClock::now() + retryDelay;
+                retryDelay = std::min(retryDelay * 2, maxRetryDelay);
+            }
+            continue;
+        }
+        
+        wakeUp.wait_until(lock, nextRefresh, [this]() {
+            return stopRequested || refreshRequested;
+        });
+    }
+}
@@ -0,0 +1,274 @@
+#include "Logger.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// ==================== LogLine ====================
+
+LogLine::LogLine(LogLevel level, const char* category)
+    : level(level), category(category), length(0) {
+    text[0] = '\0';
+}
+
+void LogLine::append(const char* data, size_t size) {
+    // Длинные сообщения обрезаем - в кольцевом буфере слоты фиксированного размера
+    size_t available = MAX_LENGTH - 1 - length;
+    if (size > available) size = available;
+    
+    std::memcpy(text + length, data, size);
+    length += size;
+    text[length] = '\0';
+}
+
+LogLine& LogLine::operator<<(const char* value) {
+    if (value) append(value, std::strlen(value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(const std::string& value) {
+    append(value.data(), value.size());
+    return *this;
+}
+
+LogLine& LogLine::operator<<(char c) {
+    append(&c, 1);
+    return *this;
+}
+
+LogLine& LogLine::operator<<(bool value) {
+    // Как у std::cout без std::boolalpha
+    return *this << (value ? '1' : '0');
+}
+
+LogLine& LogLine::operator<<(double value) {
+    char buffer[32];
+    int written = std::snprintf(buffer, sizeof(buffer), "%g", value);
+    if (written > 0) append(buffer, static_cast<size_t>(written));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(long long value) {
+    char buffer[24];
+    int written = std::snprintf(buffer, sizeof(buffer), "%lld", value);
+    if (written > 0) append(buffer, static_cast<size_t>(written));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(unsigned long long value) {
+    char buffer[24];
+    int written = std::snprintf(buffer, sizeof(buffer), "%llu", value);
+    if (written > 0) append(buffer, static_cast<size_t>(written));
+    return *this;
+}
+
+// ==================== Logger ====================
+
+Logger& Logger::getInstance() {
+    static Logger instance;
+    return instance;
+}
+
+Logger::Logger()
+    : slots(new Slot[CAPACITY]),
+      enqueuePos(0),
+      dequeuePos(0),
+      minLevel(static_cast<int>(LogLevel::Info)),
+      dropped(0),
+      accepting(true),
+      activeProducers(0),
+      running(true),
+      writerSleeping(false) {
+    
+    for (size_t i = 0; i < CAPACITY; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    
+    // MEMORY_GAME_LOG_LEVEL=debug|info|warning|error
+    const char* levelEnv = std::getenv("MEMORY_GAME_LOG_LEVEL");
+    if (levelEnv) {
+        std::string value = levelEnv;
+        if (value == "debug") minLevel = static_cast<int>(LogLevel::Debug);
+        else if (value == "info") minLevel = static_cast<int>(LogLevel::Info);
+        else if (value == "warning") minLevel = static_cast<int>(LogLevel::Warning);
+        else if (value == "error") minLevel = static_cast<int>(LogLevel::Error);
+    }
+    
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    shutdown();
+    delete[] slots;
+}
+
+void Logger::setLevel(LogLevel newLevel) {
+    minLevel.store(static_cast<int>(newLevel), std::memory_order_relaxed);
+}
+
+const char* Logger::levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warning: return "WARN";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "?";
+}
+
+void Logger::submit(const LogLine& line) {
+    // Счетчик держится до публикации слота: shutdown() ждет его обнуления,
+    // поэтому строка, уже взявшая слот, не теряется при последнем проходе писателя
+    activeProducers.fetch_add(1);
+    
+    if (!accepting.load()) {
+        activeProducers.fetch_sub(1);
+        // Логгер остановлен - пишем напрямую
+        std::cout << line.getText() << std::endl;
+        return;
+    }
+    
+    // Bounded MPSC очередь: каждый слот хранит номер позиции, для которой он свободен
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    
+    while (true) {
+        slot = &slots[pos & (CAPACITY - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        long long diff = static_cast<long long>(sequence) - static_cast<long long>(pos);
+        
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Буфер заполнен - не блокируем игровой поток, просто теряем строку
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            activeProducers.fetch_sub(1);
+            return;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    
+    slot->level = line.getLevel();
+    slot->category = line.getCategory();
+    slot->timestamp = std::chrono::system_clock::now();
+    std::memcpy(slot->text, line.getText(), line.getLength() + 1);
+    slot->length = line.getLength();
+    
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    
+    // Быстрый путь - одна загрузка флага. Барьер парный барьеру в writerLoop:
+    // либо писатель увидит опубликованный слот, либо мы увидим, что он уснул
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writerSleeping.load(std::memory_order_relaxed)) {
+        wakeWriter();
+    }
+    activeProducers.fetch_sub(1);
+}
+
+void Logger::wakeWriter() {
+    // Будит только первый застигший сон производитель
+    if (writerSleeping.exchange(false)) {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeUp.notify_one();
+    }
+}
+
+bool Logger::hasPending() const {
+    const Slot& slot = slots[dequeuePos & (CAPACITY - 1)];
+    return slot.sequence.load(std::memory_order_acquire) == dequeuePos + 1;
+}
+
+bool Logger::writeNext() {
+    Slot& slot = slots[dequeuePos & (CAPACITY - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1) {
+        return false;
+    }
+    
+    writeSlot(slot);
+    
+    // Освобождаем слот для следующего круга
+    slot.sequence.store(dequeuePos + CAPACITY, std::memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+void Logger::writeSlot(const Slot& slot) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(slot.timestamp);
+    long long millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+        slot.timestamp.time_since_epoch()).count() % 1000;
+    
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    
+    char prefix[64];
+    std::snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%03lld %-5s [%s] ",
+                  local.tm_hour, local.tm_min, local.tm_sec, millis,
+                  levelName(slot.level), slot.category ? slot.category : "-");
+    
+    std::ostream& out = (slot.level >= LogLevel::Warning) ? std::cerr : std::cout;
+    out << prefix;
+    out.write(slot.text, static_cast<std::streamsize>(slot.length));
+    out << '\n';
+}
+
+void Logger::writerLoop() {
+    while (true) {
+        bool wroteAny = false;
+        while (writeNext()) {
+            wroteAny = true;
+        }
+        
+        // Сбрасываем буфер только когда очередь опустела
+        if (wroteAny) {
+            std::cout.flush();
+        }
+        
+        if (!running.load(std::memory_order_acquire)) {
+            // Дописываем то, что успели положить перед остановкой
+            while (writeNext()) {}
+            std::cout.flush();
+            break;
+        }
+        
+        // Буфер пуст - засыпаем до первой новой строки или остановки
+        writerSleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (hasPending() || !running.load(std::memory_order_acquire)) {
+            writerSleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeUp.wait(lock, [this]() {
+            return !writerSleeping.load() || !running.load(std::memory_order_acquire);
+        });
+    }
+    
+    size_t lost = dropped.load(std::memory_order_relaxed);
+    if (lost > 0) {
+        std::cerr << "⚠ Logger: потеряно строк из-за переполнения буфера: " << lost << std::endl;
+    }
+}
+
+void Logger::shutdown() {
+    // Сначала закрываем очередь и дожидаемся производителей, которые уже
+    // внутри submit(), и только потом даем писателю сделать последний проход
+    accepting.store(false);
+    while (activeProducers.load() != 0) {
+        std::this_thread::yield();
+    }
+    
+    running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        writerSleeping.store(false);
+        wakeUp.notify_one();
+    }
+    if (writer.joinable()) {
+        writer.join();
+    }
+}
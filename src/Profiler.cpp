@@ -0,0 +1,241 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+float toMs(Profiler::ClockType::duration duration) {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+
+float percentile(std::vector<float>& values, float fraction) {
+    if (values.empty()) return 0.0f;
+    
+    size_t index = static_cast<size_t>(fraction * (values.size() - 1) + 0.5f);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+}
+
+Profiler::Profiler(size_t windowSize)
+    : enabled(false),
+      hudVisible(false),
+      windowSize(std::max<size_t>(windowSize, 1)),
+      frameNumber(0),
+      worstFrameMs(0.0f),
+      worstFrameNumber(0),
+      traceFormat(TraceFormat::NONE),
+      traceHasEvents(false) {
+    frameSection = {"frame", std::vector<float>(this->windowSize, 0.0f), 0, 0, 0.0f, 0.0f, false};
+    traceStart = ClockType::now();
+    frameStart = traceStart;
+}
+
+Profiler::~Profiler() {
+    closeTrace();
+}
+
+bool Profiler::openTrace(const std::string& path) {
+    closeTrace();
+    
+    traceFile.open(path, std::ios::out | std::ios::trunc);
+    if (!traceFile.is_open()) {
+        std::cerr << "❌ Cannot open profiler trace: " << path << std::endl;
+        return false;
+    }
+    
+    std::string lowerPath = path;
+    std::transform(lowerPath.begin(), lowerPath.end(), lowerPath.begin(), ::tolower);
+    bool isJson = lowerPath.size() >= 5 && lowerPath.compare(lowerPath.size() - 5, 5, ".json") == 0;
+    
+    if (isJson) {
+        // Формат Trace Event: открывается в chrome://tracing и Perfetto
+        traceFormat = TraceFormat::JSON;
+        traceFile << "[\n";
+    } else {
+        traceFormat = TraceFormat::CSV;
+        traceFile << "frame,section,start_us,duration_us\n";
+    }
+    
+    traceHasEvents = false;
+    traceStart = ClockType::now();
+    updateEnabled();
+    
+    std::cout << "Profiler trace: " << path << std::endl;
+    return true;
+}
+
+void Profiler::closeTrace() {
+    if (traceFormat == TraceFormat::JSON) {
+        traceFile << "\n]\n";
+    }
+    
+    if (traceFile.is_open()) {
+        traceFile.close();
+    }
+    
+    traceFormat = TraceFormat::NONE;
+    updateEnabled();
+}
+
+void Profiler::updateEnabled() {
+    enabled = hudVisible || isTracing();
+}
+
+size_t Profiler::getSectionIndex(const char* name) {
+    auto it = sectionIndex.find(name);
+    if (it != sectionIndex.end()) {
+        return it->second;
+    }
+    
+    size_t index = sections.size();
+    sections.push_back({name, std::vector<float>(windowSize, 0.0f), 0, 0, 0.0f, 0.0f, false});
+    sectionIndex[name] = index;
+    return index;
+}
+
+void Profiler::beginFrame() {
+    frameStart = ClockType::now();
+    frameSection.touched = enabled;
+}
+
+void Profiler::endFrame() {
+    if (!frameSection.touched) {
+        return;
+    }
+    frameSection.touched = false;
+    
+    ClockType::time_point frameEnd = ClockType::now();
+    float frameMs = toMs(frameEnd - frameStart);
+    pushSample(frameSection, frameMs);
+    writeTraceEvent("frame", frameStart, frameMs);
+    
+    bool isWorst = frameMs > worstFrameMs;
+    if (isWorst) {
+        worstFrameMs = frameMs;
+        worstFrameNumber = frameNumber;
+        worstFrameBreakdown.clear();
+    }
+    
+    for (auto& section : sections) {
+        if (!section.touched) continue;
+        
+        if (isWorst) {
+            worstFrameBreakdown.emplace_back(section.name, section.frameMs);
+        }
+        
+        pushSample(section, section.frameMs);
+        section.frameMs = 0.0f;
+        section.touched = false;
+    }
+    
+    frameNumber++;
+}
+
+void Profiler::addSample(const char* name, ClockType::time_point start, ClockType::time_point end) {
+    Section& section = sections[getSectionIndex(name)];
+    float ms = toMs(end - start);
+    
+    // Участок может выполняться несколько раз за кадр - суммируем
+    section.frameMs += ms;
+    section.touched = true;
+    
+    writeTraceEvent(name, start, ms);
+}
+
+void Profiler::pushSample(Section& section, float ms) {
+    section.samples[section.nextSample] = ms;
+    section.nextSample = (section.nextSample + 1) % windowSize;
+    section.sampleCount = std::min(section.sampleCount + 1, windowSize);
+    section.worstMs = std::max(section.worstMs, ms);
+}
+
+void Profiler::writeTraceEvent(const char* name, ClockType::time_point start, float durationMs) {
+    if (traceFormat == TraceFormat::NONE) {
+        return;
+    }
+    
+    long long startUs = std::chrono::duration_cast<std::chrono::microseconds>(start - traceStart).count();
+    long long durationUs = static_cast<long long>(durationMs * 1000.0f);
+    
+    if (traceFormat == TraceFormat::CSV) {
+        traceFile << frameNumber << ',' << name << ',' << startUs << ',' << durationUs << '\n';
+    } else {
+        if (traceHasEvents) {
+            traceFile << ",\n";
+        }
+        traceFile << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                  << ",\"ts\":" << startUs << ",\"dur\":" << durationUs
+                  << ",\"args\":{\"frame\":" << frameNumber << "}}";
+    }
+    
+    traceHasEvents = true;
+}
+
+Profiler::SectionStats Profiler::computeStats(const Section& section) const {
+    SectionStats stats{section.name, 0.0f, 0.0f, 0.0f, 0.0f, section.worstMs};
+    if (section.sampleCount == 0) {
+        return stats;
+    }
+    
+    size_t last = (section.nextSample + windowSize - 1) % windowSize;
+    stats.lastMs = section.samples[last];
+    
+    std::vector<float> values(section.samples.begin(), section.samples.begin() + section.sampleCount);
+    stats.p50Ms = percentile(values, 0.50f);
+    stats.p95Ms = percentile(values, 0.95f);
+    stats.p99Ms = percentile(values, 0.99f);
+    return stats;
+}
+
+std::vector<Profiler::SectionStats> Profiler::getSectionStats() const {
+    std::vector<SectionStats> result;
+    result.reserve(sections.size());
+    
+    for (const auto& section : sections) {
+        if (section.sampleCount > 0) {
+            result.push_back(computeStats(section));
+        }
+    }
+    return result;
+}
+
+std::string Profiler::buildSummary() const {
+    std::stringstream summary;
+    summary << std::fixed << std::setprecision(2);
+    
+    SectionStats frame = getFrameStats();
+    summary << "Frame " << frameNumber << "  (F3 - hide)\n";
+    summary << std::left << std::setw(20) << "section"
+            << std::right << std::setw(7) << "last"
+            << std::setw(7) << "p50"
+            << std::setw(7) << "p95"
+            << std::setw(7) << "p99"
+            << std::setw(8) << "worst" << "\n";
+    
+    auto printRow = [&summary](const SectionStats& stats) {
+        summary << std::left << std::setw(20) << stats.name
+                << std::right << std::setw(7) << stats.lastMs
+                << std::setw(7) << stats.p50Ms
+                << std::setw(7) << stats.p95Ms
+                << std::setw(7) << stats.p99Ms
+                << std::setw(8) << stats.worstMs << "\n";
+    };
+    
+    printRow(frame);
+    for (const auto& stats : getSectionStats()) {
+        printRow(stats);
+    }
+    
+    if (worstFrameMs > 0.0f) {
+        summary << "\nWorst frame #" << worstFrameNumber << ": " << worstFrameMs << " ms\n";
+        for (const auto& [name, ms] : worstFrameBreakdown) {
+            summary << "  " << name << " " << ms << " ms\n";
+        }
+    }
+    
+    return summary.str();
+}
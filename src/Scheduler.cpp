@@ -0,0 +1,55 @@
+#include "Scheduler.h"
+#include <algorithm>
+
+Scheduler::Scheduler() : nextId(1) {}
+
+Scheduler::TaskId Scheduler::schedule(float delaySeconds, std::function<void()> action) {
+    TaskId id = nextId++;
+    tasks.push_back({id, std::max(0.0f, delaySeconds), std::move(action)});
+    return id;
+}
+
+bool Scheduler::cancel(TaskId id) {
+    auto it = std::find_if(tasks.begin(), tasks.end(),
+                           [id](const Task& task) { return task.id == id; });
+    if (it == tasks.end()) {
+        return false;
+    }
+    
+    tasks.erase(it);
+    return true;
+}
+
+void Scheduler::clear() {
+    tasks.clear();
+}
+
+void Scheduler::update(float deltaTime) {
+    if (tasks.empty()) {
+        return;
+    }
+    
+    // Сначала забираем сработавшие задачи, потом выполняем:
+    // действие может запланировать новую задачу или очистить очередь
+    std::vector<Task> dueTasks;
+    for (auto it = tasks.begin(); it != tasks.end();) {
+        it->remaining -= deltaTime;
+        if (it->remaining <= 0.0f) {
+            dueTasks.push_back(std::move(*it));
+            it = tasks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    
+    for (auto& task : dueTasks) {
+        if (task.action) {
+            task.action();
+        }
+    }
+}
+
+bool Scheduler::isPending(TaskId id) const {
+    return std::any_of(tasks.begin(), tasks.end(),
+                       [id](const Task& task) { return task.id == id; });
+}
@@ -0,0 +1,194 @@
+#include "ThemeIndex.h"
+#include "AssetPack.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+    std::string withoutTrailingSlash(std::string path) {
+        while (path.size() > 1 && path.back() == '/') path.pop_back();
+        return path;
+    }
+}
+
+ThemeIndex::ThemeIndex() : inotifyFd(-1) {
+#ifdef __linux__
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        LOG_WARNING("assets", "inotify недоступен, папки тем сканируются при каждой игре");
+    }
+#endif
+}
+
+ThemeIndex::~ThemeIndex() {
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+#endif
+}
+
+bool ThemeIndex::isImageFile(const std::string& path) {
+    std::string ext = fs::path(path).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp";
+}
+
+const std::vector<std::string>& ThemeIndex::getImages(const std::string& imageDir) {
+    readEvents();
+    
+    bool known = entries.count(imageDir) > 0;
+    Entry& entry = entries[imageDir];
+    if (!entry.valid || !entry.watched) {
+        bool refresh = known && entry.watched;
+        scan(imageDir, entry);
+        
+        if (refresh && entry.watched) {
+            LOG_INFO("assets", "🔄 Папка темы изменилась: " << imageDir << " (" << entry.images.size() << " картинок)");
+        }
+    }
+    return entry.images;
+}
+
+void ThemeIndex::scan(const std::string& imageDir, Entry& entry) {
+    entry.images.clear();
+    entry.valid = true;
+    
+    // Архив ресурсов неизменен - его индекс берется как основа списка
+    AssetPack& pack = AssetPack::getInstance();
+    if (pack.isOpen()) {
+        for (const auto& name : pack.list(imageDir)) {
+            if (isImageFile(name)) entry.images.push_back(name);
+        }
+    }
+    
+    // Наблюдение ставим до обхода, чтобы не потерять файл, появившийся во время него.
+    // Родительская папка нужна, если папки темы еще нет
+    std::string directory = withoutTrailingSlash(imageDir);
+    bool parentWatched = watch(fs::path(directory).parent_path().string());
+    bool selfWatched = watch(directory);
+    
+    // Несуществующую папку тоже можно кэшировать: ее появление заметит родительская
+    std::error_code error;
+    entry.watched = parentWatched && (selfWatched || !fs::exists(directory, error));
+    
+    // Файлы с диска дополняют архив. Одноименный файл, измененный после сборки
+    // архива, заменяет копию из него; в списке путь остается один
+    fs::file_time_type packModified = fs::file_time_type::min();
+    if (pack.isOpen()) {
+        packModified = fs::last_write_time(pack.getPath(), error);
+        error.clear();
+    }
+    
+    for (const auto& file : fs::directory_iterator(imageDir, error)) {
+        std::string path = file.path().string();
+        if (!file.is_regular_file() || !isImageFile(path)) continue;
+        
+        std::error_code timeError;
+        if (pack.isOpen() && file.last_write_time(timeError) > packModified && !timeError) {
+            pack.setOverridden(path, true);
+        }
+        entry.images.push_back(path);
+    }
+    std::sort(entry.images.begin(), entry.images.end());
+    entry.images.erase(std::unique(entry.images.begin(), entry.images.end()), entry.images.end());
+    
+    if (error) {
+        LOG_WARNING("assets", "Ошибка доступа к папке " << imageDir << ": " << error.message());
+    }
+}
+
+bool ThemeIndex::watch(const std::string& directory) {
+#ifdef __linux__
+    if (inotifyFd < 0 || directory.empty()) return false;
+    
+    for (const auto& [descriptor, path] : watches) {
+        if (path == directory) return true;
+    }
+    
+    int descriptor = inotify_add_watch(inotifyFd, directory.c_str(),
+                                       IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM |
+                                       IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+    if (descriptor < 0) return false;
+    
+    watches[descriptor] = directory;
+    return true;
+#else
+    (void)directory;
+    return false;
+#endif
+}
+
+void ThemeIndex::readEvents() {
+#ifdef __linux__
+    if (inotifyFd < 0 || watches.empty()) return;
+    
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) break;
+        
+        for (ssize_t offset = 0; offset < length; ) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+            
+            if (event->mask & IN_Q_OVERFLOW) {
+                // События потеряны - пересобираем все
+                for (auto& [dir, entry] : entries) entry.valid = false;
+                continue;
+            }
+            
+            auto it = watches.find(event->wd);
+            if (it == watches.end()) continue;
+            std::string changed = it->second;
+            
+            if (event->len > 0 && isImageFile(event->name)) {
+                onImageEvent(changed + "/" + event->name, event->mask);
+            }
+            
+            if (event->mask & IN_IGNORED) {
+                // Папку удалили или переместили - наблюдение снято ядром
+                watches.erase(it);
+            }
+            
+            // Изменилась сама папка темы или родительская, где ее могли создать
+            for (auto& [dir, entry] : entries) {
+                std::string directory = withoutTrailingSlash(dir);
+                if (directory == changed || fs::path(directory).parent_path().string() == changed) {
+                    entry.valid = false;
+                    if (event->mask & IN_IGNORED) entry.watched = false;
+                }
+            }
+        }
+    }
+#endif
+}
+
+void ThemeIndex::onImageEvent(const std::string& path, unsigned int mask) {
+#ifdef __linux__
+    // Записанный или подложенный файл заменяет копию из архива, удаленный - возвращает ее
+    if (mask & (IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO)) {
+        AssetPack::getInstance().setOverridden(path, true);
+    } else if (mask & (IN_DELETE | IN_MOVED_FROM)) {
+        AssetPack::getInstance().setOverridden(path, false);
+    } else {
+        return;
+    }
+    
+    // Путь в списке тот же, а содержимое другое - декодированные копии устарели
+    if (onFileChanged) {
+        onFileChanged(path);
+    }
+#else
+    (void)path;
+    (void)mask;
+#endif
+}
@@ -1,4 +1,5 @@
 #include "Game.h"
+#include "Logger.h"
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
@@ -59,6 +60,9 @@ int main() {
         return EXIT_FAILURE;
     }
     
+    // Дописываем накопленные сообщения до финального вывода
+    Logger::getInstance().shutdown();
+    
     std::cout << "\n========================================" << std::endl;
     std::cout << "Спасибо за игру!" << std::endl;
     std::cout << "========================================" << std::endl;
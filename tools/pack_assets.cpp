@@ -0,0 +1,160 @@
+// Сборка архива ресурсов для AssetPack.
+//
+//   pack_assets -o assets.pack assets [/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf ...]
+//
+// Папки обходятся рекурсивно. Имя записи - путь в том виде, в каком он
+// передан (относительно текущей папки), именно по нему игра и ищет ресурс,
+// поэтому запускать утилиту нужно из папки, откуда запускается игра.
+
+#include "AssetPack.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::uint64_t fnv1a(const std::vector<char>& data) {
+    std::uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool isPackable(const fs::path& file) {
+    std::string ext = file.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    
+    static const char* extensions[] = {
+        ".png", ".jpg", ".jpeg", ".bmp",  // картинки
+        ".wav", ".ogg", ".flac",          // звуки и музыка
+        ".ttf", ".otf"                    // шрифты
+    };
+    for (const char* allowed : extensions) {
+        if (ext == allowed) return true;
+    }
+    return false;
+}
+
+void collect(const std::string& input, std::vector<std::string>& files) {
+    std::error_code error;
+    if (fs::is_regular_file(input, error)) {
+        files.push_back(fs::path(input).generic_string());
+        return;
+    }
+    
+    for (const auto& entry : fs::recursive_directory_iterator(input, error)) {
+        if (entry.is_regular_file() && isPackable(entry.path())) {
+            files.push_back(entry.path().generic_string());
+        }
+    }
+    
+    if (error) {
+        std::cerr << "⚠ Не удалось прочитать " << input << ": " << error.message() << std::endl;
+    }
+}
+
+void writePadding(std::ofstream& out, std::uint64_t& position) {
+    static const char zeros[PACK_ALIGNMENT] = {};
+    std::uint64_t padding = (PACK_ALIGNMENT - position % PACK_ALIGNMENT) % PACK_ALIGNMENT;
+    out.write(zeros, static_cast<std::streamsize>(padding));
+    position += padding;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string output = "assets.pack";
+    std::vector<std::string> inputs;
+    
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            inputs.push_back(argv[i]);
+        }
+    }
+    
+    if (inputs.empty()) {
+        std::cerr << "Использование: pack_assets [-o assets.pack] <папка или файл>..." << std::endl;
+        return 1;
+    }
+    
+    std::vector<std::string> files;
+    for (const auto& input : inputs) {
+        collect(input, files);
+    }
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Не удалось создать " << output << std::endl;
+        return 1;
+    }
+    
+    // Заголовок перезаписывается в конце, когда известно положение индекса
+    PackHeader header{};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::uint64_t position = sizeof(header);
+    
+    std::vector<PackIndexEntry> records;
+    std::vector<std::string> names;
+    
+    for (const auto& file : files) {
+        std::ifstream in(file, std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (!in.good() && !in.eof()) {
+            std::cerr << "⚠ Пропущен " << file << std::endl;
+            continue;
+        }
+        
+        writePadding(out, position);
+        
+        PackIndexEntry record{};
+        record.offset = position;
+        record.size = data.size();
+        record.hash = fnv1a(data);
+        record.nameLength = static_cast<std::uint32_t>(file.size());
+        
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        position += data.size();
+        
+        records.push_back(record);
+        names.push_back(file);
+    }
+    
+    writePadding(out, position);
+    header.indexOffset = position;
+    
+    for (size_t i = 0; i < records.size(); i++) {
+        out.write(reinterpret_cast<const char*>(&records[i]), sizeof(PackIndexEntry));
+        out.write(names[i].data(), static_cast<std::streamsize>(names[i].size()));
+        position += sizeof(PackIndexEntry) + names[i].size();
+    }
+    
+    header.entryCount = static_cast<std::uint32_t>(records.size());
+    header.indexSize = position - header.indexOffset;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    
+    if (!out) {
+        std::cerr << "Ошибка записи " << output << std::endl;
+        return 1;
+    }
+    
+    std::cout << "📦 " << output << ": " << records.size() << " файлов, "
+              << (position / 1024) << " КБ" << std::endl;
+    return 0;
+}
@@ -0,0 +1,400 @@
+// Бенчмарк отрисовки без окна: основные экраны игры рисуются в sf::RenderTexture
+// и замеряются, итоговые кадры сравниваются с эталонными изображениями.
+// Вход, главное меню, рекорды и достижения собираются функциями GUI/Screens -
+// тем же кодом, что вызывает Game, только с тестовыми данными. Поле карт
+// собрано из BoardLayout/BoardRenderer, как в Game::renderGame, но без HUD,
+// частиц и анимаций; остальные экраны Game::render* бенчмарк не покрывает.
+//
+// Запуск без дисплея:
+//   xvfb-run -s "-screen 0 1280x1024x24" ./render_bench
+//   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./render_bench --golden golden/
+//
+// Параметры:
+//   --iterations N     кадров на сцену (по умолчанию 500)
+//   --scene NAME       только одна сцена (login, menu, board, leaderboard, achievements)
+//   --golden DIR       сравнить кадры с DIR/<сцена>.png
+//   --update-golden    записать текущие кадры в DIR вместо сравнения
+//   --tolerance N      допустимое отличие канала (по умолчанию 8)
+//   --output DIR       сохранить кадры для просмотра
+
+#include "GUI/Button.h"
+#include "GUI/ButtonBatch.h"
+#include "GUI/CardSprite.h"
+#include "GUI/DrawableCache.h"
+#include "GUI/ScreenLayer.h"
+#include "GUI/Screens.h"
+#include "GUI/BoardLayout.h"
+#include "GUI/BoardRenderer.h"
+#include "GUI/TextureAtlas.h"
+#include "GUI/SymbolAtlas.h"
+#include "GUI/FontManager.h"
+#include "Logger.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const unsigned int CANVAS_WIDTH = 1200;
+const unsigned int CANVAS_HEIGHT = 800;
+
+struct Options {
+    int iterations = 500;
+    std::string scene;
+    std::string goldenDir;
+    std::string outputDir;
+    bool updateGolden = false;
+    int tolerance = 8;
+};
+
+// Сцена владеет своими элементами и рисует их в цель
+struct Scene {
+    std::string name;
+    std::function<void(sf::RenderTarget&)> draw;
+};
+
+struct Timing {
+    double averageMs;  // Полное время пачки кадров с ожиданием GPU, на кадр
+    double minCpuMs;   // Время подготовки и отправки одного кадра
+    double maxCpuMs;
+};
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        
+        if (arg == "--iterations" && hasValue) {
+            options.iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--scene" && hasValue) {
+            options.scene = argv[++i];
+        } else if (arg == "--golden" && hasValue) {
+            options.goldenDir = argv[++i];
+        } else if (arg == "--output" && hasValue) {
+            options.outputDir = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = std::atoi(argv[++i]);
+        } else if (arg == "--update-golden") {
+            options.updateGolden = true;
+        } else {
+            std::cerr << "Неизвестный параметр: " << arg << std::endl;
+            return false;
+        }
+    }
+    
+    if (options.updateGolden && options.goldenDir.empty()) {
+        std::cerr << "--update-golden требует --golden DIR" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool loadFont(sf::Font& font) {
+    // Тот же порядок поиска, что и в Game::loadResources
+    std::vector<std::string> fontPaths = {
+        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+        "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+        "/usr/share/fonts/truetype/ubuntu/Ubuntu-R.ttf",
+        "assets/fonts/arial.ttf",
+        "./arial.ttf"
+    };
+    
+    for (const auto& path : fontPaths) {
+        if (font.loadFromFile(path)) return true;
+    }
+    return false;
+}
+
+void noAction() {}
+
+Scene makeLoginScene(const sf::Font& font) {
+    const sf::Vector2u canvasSize(CANVAS_WIDTH, CANVAS_HEIGHT);
+    
+    auto buttons = std::make_shared<std::vector<Button>>();
+    Screens::setupLoginButtons(*buttons, font, canvasSize, noAction, noAction, noAction);
+    
+    auto errorText = std::make_shared<sf::Text>();
+    Screens::setupLoginErrorText(*errorText, font, canvasSize);
+    
+    Screens::LoginView view;
+    view.username = "player1";
+    view.passwordLength = 6;
+    view.passwordActive = true;
+    
+    auto batch = std::make_shared<ButtonBatch>();
+    
+    return {"login", [font = &font, canvasSize, view, buttons, errorText, batch](sf::RenderTarget& target) {
+        Screens::drawLogin(target, *font, canvasSize, view, *buttons, *batch, *errorText);
+    }};
+}
+
+Scene makeMenuScene(const sf::Font& font) {
+    auto title = std::make_shared<sf::Text>();
+    Screens::setupTitle(*title, font);
+    
+    auto buttons = std::make_shared<std::vector<Button>>();
+    Screens::setupMainMenuButtons(*buttons, font, noAction, noAction, noAction, noAction, noAction);
+    
+    // Как в Game::renderMenuLayer: статичная часть собирается в слой один раз
+    auto layer = std::make_shared<ScreenLayer>();
+    sf::View view(sf::FloatRect(0, 0, static_cast<float>(CANVAS_WIDTH), static_cast<float>(CANVAS_HEIGHT)));
+    if (sf::RenderTarget* target = layer->begin(1, sf::Vector2u(CANVAS_WIDTH, CANVAS_HEIGHT), view)) {
+        Screens::drawMainMenu(*target, *title, *buttons);
+        layer->end();
+    }
+    
+    return {"menu", [layer](sf::RenderTarget& target) {
+        layer->render(target);
+    }};
+}
+
+Scene makeBoardScene(const sf::Font& font) {
+    const int rows = 6;
+    const int cols = 6;
+    const float cardSize = 80.0f;
+    const float spacing = 10.0f;
+    
+    float totalWidth = cols * (cardSize + spacing) - spacing;
+    float totalHeight = rows * (cardSize + spacing) - spacing;
+    
+    auto layout = std::make_shared<BoardLayout>();
+    layout->configure(rows, cols, cardSize, spacing,
+                      sf::Vector2f((CANVAS_WIDTH - totalWidth) / 2, (CANVAS_HEIGHT - totalHeight) / 2 + 50));
+    
+    // Картинки темы животных, недостающие пары - текстовые символы через атлас
+    std::vector<std::string> images;
+    if (std::filesystem::is_directory("animals")) {
+        for (const auto& entry : std::filesystem::directory_iterator("animals")) {
+            images.push_back(entry.path().string());
+        }
+        std::sort(images.begin(), images.end());
+    }
+    TextureAtlas::getInstance().preload(images);
+    
+    auto cards = std::make_shared<std::vector<std::unique_ptr<CardSprite>>>();
+    for (int i = 0; i < rows * cols; i++) {
+        int pair = i / 2;
+        sf::Vector2f position = layout->getCardPosition(i);
+        auto card = std::make_unique<CardSprite>(i, "", position.x, position.y, cardSize);
+        
+        if (pair >= static_cast<int>(images.size()) || !card->loadImage(images[pair])) {
+            card->setSymbol("IMG" + std::to_string(pair + 1), font);
+        }
+        
+        // Часть карт открыта, чтобы в кадре были и рубашки, и лица
+        if (i % 3 == 0) card->setState(CardState::REVEALED);
+        else if (i % 3 == 1) card->setState(CardState::MATCHED);
+        cards->push_back(std::move(card));
+    }
+    
+    auto renderer = std::make_shared<BoardRenderer>();
+    BoardLayout::Range range = layout->getRange(layout->getBounds());
+    
+    return {"board", [cards, layout, renderer, range](sf::RenderTarget& target) {
+        renderer->update(*cards, *layout, range);
+        renderer->render(target);
+    }};
+}
+
+Scene makeLeaderboardScene(const sf::Font& font) {
+    const sf::Vector2u canvasSize(CANVAS_WIDTH, CANVAS_HEIGHT);
+    
+    std::vector<GameRecord> records;
+    for (int rank = 1; rank <= 10; rank++) {
+        records.push_back(GameRecord{rank, "player" + std::to_string(rank), 5000 - rank * 300, 30 + rank,
+                                     8, 40.0 + rank * 7, "2024-01-01", "Medium"});
+    }
+    
+    auto cache = std::make_shared<DrawableCache>();
+    Screens::buildLeaderboard(*cache, font, canvasSize, records);
+    
+    auto buttons = std::make_shared<std::vector<Button>>();
+    Screens::setupBackButton(*buttons, font, canvasSize, noAction);
+    
+    auto batch = std::make_shared<ButtonBatch>();
+    
+    return {"leaderboard", [cache, buttons, batch](sf::RenderTarget& target) {
+        cache->render(target);
+        batch->render(target, *buttons);
+    }};
+}
+
+Scene makeAchievementsScene(const sf::Font& font) {
+    const sf::Vector2u canvasSize(CANVAS_WIDTH, CANVAS_HEIGHT);
+    
+    // Открытые, частично пройденные и закрытые достижения всех редкостей
+    std::vector<Achievement> achievements;
+    const AchievementRarity rarities[] = {AchievementRarity::COMMON, AchievementRarity::RARE,
+                                          AchievementRarity::EPIC, AchievementRarity::LEGENDARY};
+    for (int i = 0; i < 8; i++) {
+        Achievement achievement(static_cast<AchievementType>(i), "Achievement " + std::to_string(i + 1),
+                                "Description of achievement " + std::to_string(i + 1), rarities[i % 4], "*", 10);
+        if (i % 3 == 0) achievement.unlock();
+        else achievement.addProgress(i);
+        achievements.push_back(achievement);
+    }
+    
+    Screens::AchievementsView view;
+    view.achievements = &achievements;
+    view.playerName = "player1";
+    view.unlockedCount = 3;
+    view.totalCount = static_cast<int>(achievements.size());
+    view.totalScore = 1200;
+    
+    auto cache = std::make_shared<DrawableCache>();
+    Screens::buildAchievements(*cache, font, canvasSize, view);
+    
+    auto buttons = std::make_shared<std::vector<Button>>();
+    Screens::setupBackButton(*buttons, font, canvasSize, noAction);
+    
+    auto batch = std::make_shared<ButtonBatch>();
+    
+    return {"achievements", [cache, buttons, batch](sf::RenderTarget& target) {
+        cache->render(target);
+        batch->render(target, *buttons);
+    }};
+}
+
+void drawFrame(sf::RenderTexture& canvas, const Scene& scene) {
+    canvas.clear(sf::Color(25, 25, 60));
+    scene.draw(canvas);
+    canvas.display();
+}
+
+Timing measure(sf::RenderTexture& canvas, const Scene& scene, int iterations) {
+    using Clock = std::chrono::steady_clock;
+    
+    // Прогрев: атласы глифов, загрузка вершин, ленивые кэши
+    for (int i = 0; i < 10; i++) drawFrame(canvas, scene);
+    canvas.getTexture().copyToImage();
+    
+    Timing timing{0.0, 1e9, 0.0};
+    Clock::time_point batchStart = Clock::now();
+    
+    for (int i = 0; i < iterations; i++) {
+        Clock::time_point frameStart = Clock::now();
+        drawFrame(canvas, scene);
+        double cpuMs = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+        timing.minCpuMs = std::min(timing.minCpuMs, cpuMs);
+        timing.maxCpuMs = std::max(timing.maxCpuMs, cpuMs);
+    }
+    
+    // Чтение текстуры дожидается окончания работы GPU
+    canvas.getTexture().copyToImage();
+    double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - batchStart).count();
+    timing.averageMs = totalMs / iterations;
+    return timing;
+}
+
+// Возвращает долю пикселей, отличающихся больше чем на tolerance по любому каналу
+double compareImages(const sf::Image& actual, const sf::Image& expected, int tolerance) {
+    if (actual.getSize() != expected.getSize()) return 1.0;
+    
+    sf::Vector2u size = actual.getSize();
+    const sf::Uint8* a = actual.getPixelsPtr();
+    const sf::Uint8* b = expected.getPixelsPtr();
+    size_t pixels = static_cast<size_t>(size.x) * size.y;
+    size_t mismatched = 0;
+    
+    for (size_t i = 0; i < pixels; i++) {
+        for (int c = 0; c < 4; c++) {
+            if (std::abs(static_cast<int>(a[i * 4 + c]) - static_cast<int>(b[i * 4 + c])) > tolerance) {
+                mismatched++;
+                break;
+            }
+        }
+    }
+    return pixels ? static_cast<double>(mismatched) / pixels : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) return EXIT_FAILURE;
+    
+    // Миниатюры с диска могли бы отличаться от исходников - для эталонов их не берем
+    setenv("MEMORY_GAME_THUMBNAIL_CACHE", "0", 0);
+    
+    sf::Font font;
+    if (!loadFont(font)) {
+        std::cerr << "Не найден шрифт" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    sf::RenderTexture canvas;
+    if (!canvas.create(CANVAS_WIDTH, CANVAS_HEIGHT)) {
+        std::cerr << "Не удалось создать RenderTexture (нужен GL: Xvfb или программный рендер)" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    std::vector<Scene> scenes = {
+        makeLoginScene(font),
+        makeMenuScene(font),
+        makeBoardScene(font),
+        makeLeaderboardScene(font),
+        makeAchievementsScene(font)
+    };
+    
+    int failures = 0;
+    std::printf("%-14s %10s %10s %10s  %s\n", "scene", "avg ms", "min cpu", "max cpu", "golden");
+    
+    for (const auto& scene : scenes) {
+        if (!options.scene.empty() && scene.name != options.scene) continue;
+        
+        Timing timing = measure(canvas, scene, options.iterations);
+        
+        drawFrame(canvas, scene);
+        sf::Image frame = canvas.getTexture().copyToImage();
+        std::string fileName = scene.name + ".png";
+        
+        if (!options.outputDir.empty()) {
+            std::filesystem::create_directories(options.outputDir);
+            frame.saveToFile(options.outputDir + "/" + fileName);
+        }
+        
+        std::string goldenStatus = "-";
+        if (!options.goldenDir.empty()) {
+            std::string goldenPath = options.goldenDir + "/" + fileName;
+            
+            if (options.updateGolden) {
+                std::filesystem::create_directories(options.goldenDir);
+                goldenStatus = frame.saveToFile(goldenPath) ? "updated" : "write failed";
+            } else {
+                sf::Image expected;
+                if (!expected.loadFromFile(goldenPath)) {
+                    goldenStatus = "missing";
+                    failures++;
+                } else {
+                    // Допускаем сглаживание на паре пикселей у разных драйверов
+                    double mismatch = compareImages(frame, expected, options.tolerance);
+                    char buffer[48];
+                    std::snprintf(buffer, sizeof(buffer), "%s (%.3f%%)",
+                                  mismatch <= 0.001 ? "ok" : "MISMATCH", mismatch * 100.0);
+                    goldenStatus = buffer;
+                    if (mismatch > 0.001) failures++;
+                }
+            }
+        }
+        
+        std::printf("%-14s %10.3f %10.3f %10.3f  %s\n", scene.name.c_str(),
+                    timing.averageMs, timing.minCpuMs, timing.maxCpuMs, goldenStatus.c_str());
+    }
+    
+    // Текстуры атласов освобождаем, пока жив GL-контекст
+    scenes.clear();
+    SymbolAtlas::getInstance().clear();
+    TextureAtlas::getInstance().clear();
+    FontManager::getInstance().clear();
+    Logger::getInstance().shutdown();
+    
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}